@@ -12,19 +12,49 @@
 #include "detail/type_quat.hpp"
 
 /**
- * @brief Contains a single model matrix that can be updated every frame.
+ * @brief The position, orientation and scale of an object as one value. Objects store these as the separate Position,
+ * Rotation and Scale components, so that systems only bring the parts they use into cache. This is used where all three
+ * are needed at once (e.g., by the TransformHierarchy).
  */
-struct ModelMatrix
-{
-    glm::mat4 value { 1.f };
-};
-
-/** Holds the position, orientation and scale of an object. Note: this should be split to improve cache miss optimisation. */
 struct Transform
 {
     glm::vec3 position { 0.f };
     glm::quat rotation { glm::vec3(0.f) };
     glm::vec3 scale    { 1.f };
+    
+    bool operator==(const Transform &other) const
+    {
+        return position == other.position && rotation == other.rotation && scale == other.scale;
+    }
+    
+    bool operator!=(const Transform &other) const { return !(*this == other); }
+};
+
+/** Written by the linear integrators every tick. */
+struct Position
+{
+    glm::vec3 value { 0.f };
+};
+
+/** Written by the angular integrators, so only rotating bodies touch it. */
+struct Rotation
+{
+    glm::quat value { glm::vec3(0.f) };
+};
+
+/** Hardly ever changes once an object is made. */
+struct Scale
+{
+    glm::vec3 value { 1.f };
+};
+
+/**
+ * @brief The node of an object in the scene's TransformHierarchy, which holds its world matrix. Entities that share a
+ * node (e.g., every mesh slot of a model) are drawn with the same matrix.
+ */
+struct TransformNode
+{
+    uint32_t index { 0 };
 };
 
 /** Holds information about how to rotate an object. */
@@ -34,8 +64,3 @@ struct Rotator
     float       height          { 0.f };
     glm::vec3   originalHeight  { 0.f };
 };
-
-struct Position
-{
-    glm::vec3 value { 0.f };
-};
@@ -0,0 +1,35 @@
+/**
+ * @file BatchIds.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+
+/**
+ * Small ids for the parts of a geometry batch sort key, given out once when a mesh, vao or material is made so that
+ * sorting never has to look them up. Running out of any of them is fatal, as a larger id would spill into the next
+ * part of the key.
+ */
+namespace batch
+{
+    /** The bits that each id has within a sort key. */
+    constexpr uint32_t materialBits { 16 };
+    constexpr uint32_t vaoBits      { 8 };
+    constexpr uint32_t meshBits     { 24 };
+    
+    /** @returns An id that no other mesh has. */
+    uint32_t nextMeshId();
+    
+    /** @returns An id that no other vao has. */
+    uint32_t nextVaoId();
+    
+    /**
+     * @returns The id of a set of textures, which is the same for every material made with them. Materials without
+     * any textures are 0.
+     */
+    uint32_t materialId(unsigned int firstTexture, unsigned int secondTexture=0);
+}
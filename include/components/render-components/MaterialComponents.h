@@ -10,6 +10,7 @@
 #include "Pch.h"
 #include "glm.hpp"
 #include "TextureLoader.h"
+#include "BatchIds.h"
 
 struct MtlMaterial;
 
@@ -67,13 +68,16 @@ struct BlinnPhongMaterial
     explicit BlinnPhongMaterial(const MtlMaterial &mtl)
         : ambientColour(mtl.kA), diffuseColour(mtl.kD),
           specularColour(mtl.kS), specularExponent(mtl.nS),
-          diffuseTextureId(load::texture(mtl.mapKd)) {}
+          diffuseTextureId(load::texture(mtl.mapKd)), batchId(batch::materialId(diffuseTextureId)) {}
     
     glm::vec3       ambientColour       { 0.2f };
     glm::vec3       diffuseColour       { 0.8f };
     glm::vec3       specularColour      { 1.f };
     unsigned int    specularExponent    { 10 };
     unsigned int    diffuseTextureId    { 0 };
+    
+    /** The id of the textures within a geometry batch sort key. Must be declared after them. */
+    uint32_t        batchId             { 0 };
 };
 
 struct EmissivePbrMaterial
@@ -86,7 +90,8 @@ struct EmissivePbrMaterial
         ambientColour(mtl.kA), diffuseColour(mtl.kD),
         specularColour(mtl.kS), specularExponent(mtl.nS),
         diffuseTextureId(load::texture(mtl.mapKd)),
-        emissiveTextureId(load::texture(mtl.mapKe)) {}
+        emissiveTextureId(load::texture(mtl.mapKe)),
+        batchId(batch::materialId(diffuseTextureId, emissiveTextureId)) {}
     
     glm::vec3       ambientColour       { 0.2f };
     glm::vec3       diffuseColour       { 0.8f };
@@ -94,4 +99,7 @@ struct EmissivePbrMaterial
     unsigned int    specularExponent    { 10 };
     unsigned int    diffuseTextureId    { 0 };
     unsigned int    emissiveTextureId   { 0 };
+    
+    /** The id of the textures within a geometry batch sort key. Must be declared after them. */
+    uint32_t        batchId             { 0 };
 };
\ No newline at end of file
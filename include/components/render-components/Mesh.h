@@ -10,6 +10,8 @@
 #include "Pch.h"
 #include "glew.h"
 #include "RawMesh.h"
+#include "MeshBuffer.h"
+#include "BatchIds.h"
 
 #include <cstdint>
 #include <vector>
@@ -17,7 +19,39 @@
 void setVaoLayout(unsigned int vao, const Instructions &instructions);
 
 /**
- * @brief The returned information for rendering an object to the screen with OpenGL.
+ * @brief Draws every index of a mesh from the buffers shared by its vertex format. The vao must already be bound.
+ */
+void drawElements(const RenderInformation &renderInformation, GLenum mode=GL_TRIANGLES);
+
+/**
+ * @brief A sphere centred on the bounding box of vertices that contains all of them.
+ * @returns The centre in xyz and the radius in w.
+ */
+template<typename TVertex>
+glm::vec4 boundingSphere(const std::vector<TVertex> &vertices)
+{
+    if (vertices.empty())
+        return glm::vec4(0.f);
+    
+    glm::vec3 min = vertices[0].position;
+    glm::vec3 max = vertices[0].position;
+    for (const TVertex &vertex : vertices)
+    {
+        min = glm::min(min, vertex.position);
+        max = glm::max(max, vertex.position);
+    }
+    
+    const glm::vec3 centre = 0.5f * (min + max);
+    float radiusSquared = 0.f;
+    for (const TVertex &vertex : vertices)
+        radiusSquared = glm::max(radiusSquared, glm::dot(vertex.position - centre, vertex.position - centre));
+    
+    return glm::vec4(centre, glm::sqrt(radiusSquared));
+}
+
+/**
+ * @brief The returned information for rendering an object to the screen with OpenGL. The vertices and indices are
+ * stored in the mesh buffer of TVertex along with every other mesh of that format.
  * @tparam TMaterial - The type of material that you want to store.
  * @author Ryan Purse
  * @date 14/03/2022
@@ -30,8 +64,7 @@ struct Mesh
     
     RenderInformation   renderInformation;
     TMaterial           material;
-    unsigned int        vbo { 0 };
-    unsigned int        ebo { 0 };
+    MeshBuffer::Range   range;
 };
 
 template<typename TVertex, typename TMaterial>
@@ -43,44 +76,36 @@ Mesh<TVertex, TMaterial>::Mesh(const std::vector<TVertex> &vertices, const std::
                                TMaterial mat)
     : material(std::move(mat))
 {
-    glCreateBuffers(1, &vbo);
-    glCreateBuffers(1, &ebo);
-    glNamedBufferData(vbo, vertices.size() * sizeof(TVertex), static_cast<const void *>(&vertices[0]), GL_STATIC_DRAW);
-    glNamedBufferData(ebo, indices.size() * sizeof(uint32_t), static_cast<const void *>(&indices[0]), GL_STATIC_DRAW);
-    renderInformation.eboCount = indices.size();
-    
-    glCreateVertexArrays(1, &renderInformation.vao);
-    
-    const unsigned int bindingIndex = 0;
-    const unsigned int offSet = 0;
-    const unsigned int stride = sizeof(TVertex);
+    MeshBuffer &buffer = meshBuffer<TVertex>();
+    range = buffer.allocate(
+        static_cast<const void *>(&vertices[0]), static_cast<uint32_t>(vertices.size()),
+        static_cast<const void *>(&indices[0]), static_cast<uint32_t>(indices.size()));
     
-    setVaoLayout(renderInformation.vao, TVertex::instructions());
-    
-    glVertexArrayVertexBuffer(renderInformation.vao, bindingIndex, vbo, offSet, stride);
-    glVertexArrayElementBuffer(renderInformation.vao, ebo);
+    renderInformation.vao = buffer.vao();
+    renderInformation.eboCount = indices.size();
+    renderInformation.firstIndex = range.firstIndex;
+    renderInformation.baseVertex = static_cast<int>(range.firstVertex);
+    renderInformation.bounds = boundingSphere(vertices);
+    renderInformation.vaoId = buffer.vaoId();
+    renderInformation.meshId = batch::nextMeshId();
 }
 
 template<typename TVertex, typename TMaterial>
 Mesh<TVertex, TMaterial>::Mesh(const load::RawMesh<TVertex> &mesh, TMaterial mat)
     : material(std::move(mat))
 {
-    glCreateBuffers(1, &vbo);
-    glCreateBuffers(1, &ebo);
-    glNamedBufferData(vbo, mesh.verticesSize(), mesh.verticesData(), GL_STATIC_DRAW);
-    glNamedBufferData(ebo, mesh.indicesSize(), mesh.indicesData(), GL_STATIC_DRAW);
-    renderInformation.eboCount = mesh.indicesCount();
-    
-    glCreateVertexArrays(1, &renderInformation.vao);
-    
-    const unsigned int bindingIndex = 0;
-    const unsigned int offSet = 0;
-    const unsigned int stride = sizeof(TVertex);
+    MeshBuffer &buffer = meshBuffer<TVertex>();
+    range = buffer.allocate(
+        mesh.verticesData(), static_cast<uint32_t>(mesh.verticesSize() / sizeof(TVertex)),
+        mesh.indicesData(), static_cast<uint32_t>(mesh.indicesCount()));
     
-    setVaoLayout(renderInformation.vao, TVertex::instructions());
-    
-    glVertexArrayVertexBuffer(renderInformation.vao, bindingIndex, vbo, offSet, stride);
-    glVertexArrayElementBuffer(renderInformation.vao, ebo);
+    renderInformation.vao = buffer.vao();
+    renderInformation.eboCount = mesh.indicesCount();
+    renderInformation.firstIndex = range.firstIndex;
+    renderInformation.baseVertex = static_cast<int>(range.firstVertex);
+    renderInformation.bounds = boundingSphere(mesh.vertices());
+    renderInformation.vaoId = buffer.vaoId();
+    renderInformation.meshId = batch::nextMeshId();
 }
 
 
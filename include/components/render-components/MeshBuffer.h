@@ -0,0 +1,82 @@
+/**
+ * @file MeshBuffer.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "Vertices.h"
+
+/**
+ * One vertex buffer, one index buffer and one vao shared by every mesh of a vertex format. Each mesh is given a range
+ * of both buffers and is drawn with a base vertex, so meshes of the same format never need to rebind a vao.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class MeshBuffer
+{
+public:
+    /** Where a mesh lives within the shared buffers. Offsets and counts are in vertices and indices, not bytes. */
+    struct Range
+    {
+        uint32_t firstVertex    { 0 };
+        uint32_t vertexCount    { 0 };
+        uint32_t firstIndex     { 0 };
+        uint32_t indexCount     { 0 };
+    };
+    
+    MeshBuffer(uint32_t vertexSize, const Instructions &instructions);
+    
+    /**
+     * @brief Copies the vertices and indices of a mesh into free space of the shared buffers. Both buffers grow if
+     * there is not enough space left, which keeps the vao the same.
+     */
+    Range allocate(const void *vertices, uint32_t vertexCount, const void *indices, uint32_t indexCount);
+    
+    /** @brief Gives a range back so that later meshes can use it. */
+    void release(const Range &range);
+    
+    [[nodiscard]] unsigned int vao() const;
+    
+    /** @returns The id of the vao within a geometry batch sort key. */
+    [[nodiscard]] uint32_t vaoId() const;
+
+protected:
+    struct FreeBlock
+    {
+        uint32_t offset { 0 };
+        uint32_t count  { 0 };
+    };
+    
+    /** A buffer of fixed sized elements with a sorted list of the blocks that are not in use. */
+    struct Arena
+    {
+        unsigned int            buffer      { 0 };
+        uint32_t                elementSize { 0 };
+        uint32_t                capacity    { 0 };
+        std::vector<FreeBlock>  freeBlocks;
+    };
+    
+    static uint32_t allocate(Arena &arena, const void *data, uint32_t count);
+    static void release(Arena &arena, uint32_t offset, uint32_t count);
+    static void grow(Arena &arena, uint32_t minimumCount);
+    
+    unsigned int    mVao        { 0 };
+    uint32_t        mVaoId      { 0 };
+    Arena           mVertices;
+    Arena           mIndices;
+};
+
+/**
+ * @brief The buffers shared by every mesh made of TVertex. They live until the program closes, since meshes of the
+ * format can be made by any scene.
+ */
+template<typename TVertex>
+MeshBuffer &meshBuffer()
+{
+    static MeshBuffer buffer { sizeof(TVertex), TVertex::instructions() };
+    return buffer;
+}
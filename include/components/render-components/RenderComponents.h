@@ -15,8 +15,17 @@
  */
 struct RenderInformation
 {
-    unsigned int    vao      { 0 };
-    int             eboCount { 0 };
+    unsigned int    vao         { 0 };
+    int             eboCount    { 0 };
+    uint32_t        firstIndex  { 0 };
+    int             baseVertex  { 0 };
+    
+    /** A sphere around every vertex in model space. xyz is the centre and w is the radius. */
+    glm::vec4       bounds      { 0.f };
+    
+    /** Given out when the mesh is made, so that geometry batches can sort by them. See BatchIds.h. */
+    uint32_t        vaoId       { 0 };
+    uint32_t        meshId      { 0 };
     // Matrix Uniforms are not included since they need to be updated every frame.
 };
 
@@ -35,6 +35,10 @@ public:
     
     [[nodiscard]] const glm::mat4 &getViewMatrix() const;
     
+    [[nodiscard]] const glm::mat4 &getProjectionMatrix() const;
+    
+    [[nodiscard]] float getFarClip() const;
+    
     [[nodiscard]] const glm::vec3 &getPosition() const;
 
 protected:
@@ -20,6 +20,15 @@
 #include "WindowHelpers.h"
 #include "MipmapTexture.h"
 #include "TextureViewer.h"
+#include "TransformHierarchy.h"
+#include "GeometryBatch.h"
+#include "CameraUniformBuffer.h"
+#include "DirectionalLighting.h"
+#include "LightVolumes.h"
+#include "ClusteredLighting.h"
+#include "InstancedLightVolumes.h"
+#include "FusedLighting.h"
+#include "GpuTimer.h"
 
 struct ViewSettings
 {
@@ -46,7 +55,8 @@ struct ViewSettings
 class Renderer
 {
 public:
-    Renderer(std::shared_ptr<MainCamera> camera, ecs::Core &EntityComponentSystem);
+    Renderer(std::shared_ptr<MainCamera> camera, ecs::Core &EntityComponentSystem, std::shared_ptr<TransformHierarchy> hierarchy);
+    ~Renderer();
     
     void clear();
     void update();
@@ -54,21 +64,35 @@ public:
     void imguiMenuUpdate();
     
     void drawBox(const glm::mat4 &modelMatrix, const glm::vec3 &halfSize);
+
+
+protected:
+    /**
+     * @brief Times setting a uniform by name against setting it through a handle, so that the cost of the lookups
+     * that handles remove can be shown per frame.
+     */
+    void measureUniformSets();
+    
+    /**
+     * @brief Adds point lights at random around the origin until the renderer has made count of them, so that both
+     * point light paths can be compared at the same load. Lights are never removed, as the ecs cannot destroy them.
+     */
+    void spawnPointLights(uint32_t count);
     
     
-protected:
     // NOTE: Order of declaration matters here.
     ecs::Core &mEcs;
-    
+
 public:
     // Tags let us know which object should be rendered in which way.
     const Component geometryTag { mEcs.create<RenderInformation>() };
     const Component emissiveTag { mEcs.create<RenderInformation>() };
-    
+
 protected:
     glm::ivec2 mSize { window::bufferSize() };
     
     std::shared_ptr<MainCamera> mCamera;  // Must be declared first. Other object rely on this being set.
+    std::shared_ptr<TransformHierarchy> mHierarchy;
     
     const int mMipmapLevels { 8 };  // Must be before frame and texture buffer creation.
     
@@ -91,6 +115,33 @@ protected:
     
     ViewSettings mShow;
     
+    CameraUniformBuffer mCameraUniforms;
+    uint32_t mUniformSetsPerFrame       { 0 };
+    double mStringSetMicroseconds       { 0.0 };
+    double mHandleSetMicroseconds       { 0.0 };
+    
+    std::shared_ptr<HierarchicalDepth> mHierarchicalDepth { std::make_shared<HierarchicalDepth>(mSize) };
+    
+    std::shared_ptr<DirectionalLighting> mDirectionalLighting { std::make_shared<DirectionalLighting>(
+        mLightAccumulator, mPosition, mNormal, mAlbedo) };
+    std::shared_ptr<LightVolumes> mLightVolumes { std::make_shared<LightVolumes>(
+        mCamera, mLightAccumulator, mPosition, mNormal, mAlbedo) };
+    std::shared_ptr<ClusteredLighting> mClusteredLighting { std::make_shared<ClusteredLighting>(
+        mCamera, mLightAccumulator, mPosition, mNormal, mAlbedo) };
+    std::shared_ptr<InstancedLightVolumes> mInstancedLightVolumes { std::make_shared<InstancedLightVolumes>(
+        mLightAccumulator, mGeometry, mPosition, mNormal, mAlbedo) };
+    std::shared_ptr<FusedLighting> mFusedLighting { std::make_shared<FusedLighting>(
+        mCamera, mClusteredLighting, mLightTarget, mPosition, mNormal, mAlbedo, mEmissive) };
+    std::shared_ptr<GpuTimer> mLightingTimer { std::make_shared<GpuTimer>() };
+    uint32_t mSpawnedLights { 0 };
+    
+    std::shared_ptr<GeometryBatch> mBlinnPhongBatch { std::make_shared<GeometryBatch>(
+        path::shaders() + "/blinn-phong/BlinnPhong.vert", path::shaders() + "/blinn-phong/BlinnPhongGeometry.frag",
+        std::vector<std::string> { "u_texture" }) };
+    std::shared_ptr<GeometryBatch> mEmissiveBatch { std::make_shared<GeometryBatch>(
+        path::shaders() + "/blinn-phong/BlinnPhong.vert", path::shaders() + "/geometry/EmissiveGeometry.frag",
+        std::vector<std::string> { "u_diffuse_texture", "u_emissive_texture" }) };
+    
     DeferredLightShader mDeferredLightingShader;
     MipViewer mDownSamplingMipViewerShader;
     MipViewer mUpSamplingMipViewerShader;
@@ -100,6 +151,8 @@ protected:
     // Debug Helpers
     Mesh<UvVertex, NoMaterial> mBox { load::model<UvVertex, NoMaterial>(path::resources() + "models/physics/Box.obj")[0] };
     Shader mBoxShader { path::shaders() + "physics/BoxVolume.vert",       path::shaders() + "physics/BoxVolume.frag" };
+    Shader::Uniform<glm::mat4> mBoxModelMatrix  { mBoxShader.uniform<glm::mat4>("u_model_matrix") };
+    Shader::Uniform<glm::vec3> mBoxHalfSize     { mBoxShader.uniform<glm::vec3>("u_halfsize") };
 };
 
 
@@ -10,18 +10,70 @@
 #include "Pch.h"
 #include <filesystem>
 
+/** A texture and the unit that it is bound to, which is what a sampler uniform is set with. */
+struct TextureUnit
+{
+    unsigned int    textureId   { 0 };
+    int             bindPoint   { 0 };
+};
+
+/** How the programs asked for since the last reset were made, and how long making them took. */
+struct ProgramStats
+{
+    uint32_t    compiled            { 0 };
+    uint32_t    loaded              { 0 };  // From the program binary cache on disk.
+    uint32_t    shared              { 0 };  // With a shader of the same files that already exists.
+    double      milliseconds        { 0.0 };
+    double      waitMilliseconds    { 0.0 };  // On programs that were still compiling when first used.
+};
+
 /**
- * Holds and compiles the shader program for OpenGL.
+ * Holds and compiles the shader program for OpenGL. Shaders made from the same files share one program, and linked
+ * programs are cached on disk so that later runs can skip compiling them.
  * @author Ryan Purse
  * @date 13/02/2022
  */
 class Shader
 {
 public:
+    /**
+     * A uniform whose location is looked up once, rather than on every set. The look-up waits until the shader is
+     * first used, so that it does not stall a program compiling in the background. Sets the program directly, so
+     * the shader does not need to be bound.
+     */
+    template<typename T>
+    class Uniform
+    {
+        friend class Shader;
+    public:
+        Uniform() = default;
+        
+        void set(const T &value) const;
+    
+    protected:
+        Uniform(Shader *shader, std::size_t index) : mShader(shader), mIndex(index) {}
+        
+        Shader         *mShader     { nullptr };
+        std::size_t     mIndex      { 0 };
+    };
+    
     Shader(const std::filesystem::path &vertexPath, const std::filesystem::path &fragmentPath);
+    
+    /**
+     * @brief Creates a program made of a single compute shader.
+     */
+    explicit Shader(const std::filesystem::path &computePath);
     virtual ~Shader();
     
-    void bind() const;
+    /**
+     * @brief Lets the driver compile and link programs on its own threads, so that shaders only wait for them when
+     * they are first used. Must be called once a context exists.
+     * @returns False if neither parallel shader compile extension is supported, in which case shaders finish
+     * compiling as soon as they are made.
+     */
+    static bool enableParallelCompile();
+    
+    void bind();
     static void unbind();
     
     /**
@@ -73,15 +125,77 @@ public:
      * @param bindPoint - The binding point of the texture [0-8].
      */
     void set(const std::string &uniformName, const int textureId, const int bindPoint);
+    
+    /**
+     * @brief Finds a uniform within the shader so that it can be set without looking it up again.
+     * @param uniformName - The name within the shader.
+     */
+    template<typename T>
+    Uniform<T> uniform(const std::string &uniformName)
+    {
+        return Uniform<T>(this, addUniform(uniformName));
+    }
+    
+    /** @returns The number of uniforms set through handles since the last reset. */
+    static uint32_t uniformSetCount();
+    static void resetUniformSetCount();
+    
+    static const ProgramStats &programStats();
+    static void resetProgramStats();
+    
+    /**
+     * @brief Deletes every program binary (*.bin) in the cache directory, so that the next run compiles everything
+     * again. Nothing else in the directory is touched.
+     */
+    static void clearProgramCache();
 
 protected:
+    struct Stage
+    {
+        unsigned int            type;
+        std::filesystem::path   path;
+    };
+    
     std::string mDebugName { "" };
     unsigned int mId { 0 };
     std::unordered_map<std::string , int> mCache;
     
+    /** Set while the program may still be compiling. Cleared by the first bind or uniform look-up. */
+    bool mIsLinking { false };
+    std::vector<std::string> mUniformNames;
+    std::vector<int> mLocations;
+    
     int getLocation(const std::string &name);
     
-    static unsigned int compile(unsigned int type, std::string_view path);
+    /** @returns The index of the uniform, as its location may not be known yet. */
+    std::size_t addUniform(const std::string &name);
+    int location(std::size_t index);
+    
+    /**
+     * @brief Shares the program of these stages if it already exists. Otherwise, loads it from the program binary
+     * cache or compiles and links it, then caches it.
+     */
+    void create(const std::vector<Stage> &stages);
+    
+    /**
+     * @brief Waits for the program to link, logs any errors, caches its binary and looks up any uniforms that were
+     * asked for while it was linking.
+     */
+    void finish();
+    
+    /** @returns True if a binary of the program was in the cache and the driver accepted it. */
+    bool loadBinary(const std::filesystem::path &cachePath);
+    void saveBinary(const std::filesystem::path &cachePath);
+    
+    static std::string read(const std::filesystem::path &path);
+    static unsigned int compile(unsigned int type, const std::string &source);
+    static void logCompileErrors(unsigned int id);
 };
 
-
+template<> void Shader::Uniform<int>::set(const int &value) const;
+template<> void Shader::Uniform<float>::set(const float &value) const;
+template<> void Shader::Uniform<glm::mat4>::set(const glm::mat4 &value) const;
+template<> void Shader::Uniform<glm::vec4>::set(const glm::vec4 &value) const;
+template<> void Shader::Uniform<glm::vec3>::set(const glm::vec3 &value) const;
+template<> void Shader::Uniform<glm::vec2>::set(const glm::vec2 &value) const;
+template<> void Shader::Uniform<TextureUnit>::set(const TextureUnit &value) const;
@@ -15,4 +15,7 @@ namespace path
     std::string resources();
     std::string shaders();
     std::string textures();
+    
+    /** Where linked programs are cached between runs. Relative to the working directory, as it is not a resource. */
+    std::string shaderCache();
 }
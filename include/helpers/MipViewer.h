@@ -44,11 +44,13 @@ protected:
     std::unique_ptr<FramebufferObject>   mFramebufferObject;
     
     Shader mShader { path::shaders()  + "ScreenOverlay.vert", path::shaders() + "post-processing/MipView.frag" };
+    Shader::Uniform<int>         mMipLevel  { mShader.uniform<int>("u_mip_level") };
+    Shader::Uniform<glm::vec2>   mMipSize   { mShader.uniform<glm::vec2>("u_mip_size") };
+    Shader::Uniform<TextureUnit> mTexture   { mShader.uniform<TextureUnit>("u_texture") };
+    Shader::Uniform<glm::mat4>   mMvpMatrix { mShader.uniform<glm::mat4>("u_mvp_matrix") };
     
     bool            mFill           { false };
     bool            mResize         { false };
-    unsigned int    mVao            { 0 };
-    int             mEboCount       { 0 };
-    unsigned int    mEbo            { 0 };
-    unsigned int    mVbo            { 0 };
+    
+    Mesh<UvVertex, NoMaterial> mQuad { primitives::plane<UvVertex>()[0] };
 };
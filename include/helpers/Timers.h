@@ -8,19 +8,34 @@
 #pragma once
 
 #include "Pch.h"
-#include <glfw3.h>
 
 namespace timers
 {
+    /** A monotonic clock that returns the time in seconds. */
+    using Clock = double(*)();
+    
     extern double deltaTime_impl;
-    extern double fixedTime_impl;
+    
+    /** Thread local so that independent worlds can be stepped on different threads with their own fixed time. */
+    extern thread_local double fixedTime_impl;
+    extern Clock  clock_impl;
     
     void update();
     
+    /**
+     * @returns The seconds since the program started, measured with std::chrono::steady_clock. The default clock.
+     */
+    double steadyClock();
+    
+    /**
+     * @brief Replaces the clock that every timer reads from (e.g., with a simulated clock for reproducible runs).
+     */
+    void setClock(Clock clock);
+    
     template<typename T>
     T getTicks()
     {
-        return static_cast<T>(glfwGetTime());
+        return static_cast<T>(clock_impl());
     }
     
     template<typename T>
@@ -30,9 +45,51 @@ namespace timers
     }
     
     template<typename T>
-    constexpr T fixedTime()
+    T fixedTime()
     {
         return static_cast<T>(fixedTime_impl);
     }
     
+    /**
+     * @brief Sets the fixed time of the current thread until the scope ends.
+     */
+    class FixedTimeScope
+    {
+    public:
+        explicit FixedTimeScope(const double fixedTime) : mPrevious(fixedTime_impl) { fixedTime_impl = fixedTime; }
+        ~FixedTimeScope() { fixedTime_impl = mPrevious; }
+        
+        FixedTimeScope(const FixedTimeScope &) = delete;
+        FixedTimeScope &operator=(const FixedTimeScope &) = delete;
+    
+    protected:
+        double mPrevious;
+    };
+    
+    /**
+     * @returns How long function took to run in milliseconds.
+     */
+    template<typename TFunction>
+    double measure(TFunction &&function)
+    {
+        const double start = getTicks<double>();
+        function();
+        return (getTicks<double>() - start) * 1000.0;
+    }
+    
+    /**
+     * @brief Calls function repeats times, where each call processes itemCount items.
+     * @returns How many items were processed per millisecond, or 0 if it ran too quickly to be timed.
+     */
+    template<typename TFunction>
+    double itemsPerMs(const uint64_t itemCount, const uint32_t repeats, TFunction &&function)
+    {
+        const double elapsedMs = measure([&]() {
+            for (uint32_t i = 0; i < repeats; ++i)
+                function();
+        });
+        
+        return elapsedMs > 0.0 ? static_cast<double>(itemCount) * repeats / elapsedMs : 0.0;
+    }
+    
 }
\ No newline at end of file
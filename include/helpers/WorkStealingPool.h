@@ -0,0 +1,114 @@
+/**
+ * @file WorkStealingPool.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "Timers.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief A fixed set of worker threads that each own a queue of tasks. Workers take the newest task from their own
+ * queue and steal the oldest task from another queue when theirs is empty. One pool is shared by the whole engine
+ * (instance()) so that parallel systems and world batches never create more threads than there are cores.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class WorkStealingPool
+{
+public:
+    using Task = std::function<void()>;
+    
+    explicit WorkStealingPool(uint32_t workerCount);
+    ~WorkStealingPool();
+    
+    WorkStealingPool(const WorkStealingPool &) = delete;
+    WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+    
+    /**
+     * @returns The pool shared by the engine. It has one worker for every core other than those of the main and
+     * physics threads, which both submit to it and help to run their own work.
+     */
+    static WorkStealingPool &instance();
+    
+    /**
+     * @brief Splits [0, count) into chunks of grainSize and calls function(first, last) for each one. The calling
+     * thread runs chunks as well, and only returns once every chunk has finished, so function may capture locals.
+     * Chunks see the fixed time of the calling thread, wherever they run.
+     */
+    template<typename TFunction>
+    void parallelFor(uint32_t count, uint32_t grainSize, TFunction &&function);
+    
+    [[nodiscard]] uint32_t workerCount() const { return static_cast<uint32_t>(mWorkers.size()); }
+
+protected:
+    struct Queue
+    {
+        std::mutex          mutex;
+        std::deque<Task>    tasks;
+    };
+    
+    void push(uint32_t queue, Task task);
+    
+    void wakeWorkers();
+    
+    /**
+     * @brief Runs a task from queue (newest first) or steals one from the other queues (oldest first).
+     * @returns False if every queue was empty.
+     */
+    bool runTask(uint32_t queue);
+    
+    void workerLoop(uint32_t index);
+    
+    std::vector<std::unique_ptr<Queue>> mQueues;
+    std::vector<std::thread>            mWorkers;
+    std::atomic<bool>                   mRunning    { true };
+    std::atomic<uint32_t>               mQueued     { 0 };
+    std::atomic<uint32_t>               mNextQueue  { 0 };
+    std::mutex                          mSleepMutex;
+    std::condition_variable             mWake;
+};
+
+template<typename TFunction>
+void WorkStealingPool::parallelFor(const uint32_t count, const uint32_t grainSize, TFunction &&function)
+{
+    const uint32_t grain = std::max(grainSize, 1u);
+    if (count <= grain || mWorkers.empty())
+    {
+        function(0u, count);
+        return;
+    }
+    
+    // The fixed time is thread local, so workers would otherwise read their own default rather than the caller's.
+    const auto fixedTime = timers::fixedTime<double>();
+    const uint32_t chunkCount = (count + grain - 1) / grain;
+    std::atomic<uint32_t> remaining { chunkCount };
+    for (uint32_t chunk = 0; chunk < chunkCount; ++chunk)
+    {
+        const uint32_t first = chunk * grain;
+        const uint32_t last = std::min(first + grain, count);
+        push(mNextQueue++ % workerCount(), [&function, &remaining, fixedTime, first, last]() {
+            timers::FixedTimeScope fixedTimeScope(fixedTime);
+            function(first, last);
+            --remaining;
+        });
+    }
+    wakeWorkers();
+    
+    // Helping rather than blocking means that a parallelFor started from inside a task can never deadlock the pool.
+    while (remaining > 0)
+    {
+        if (!runTask(mNextQueue % workerCount()))
+            std::this_thread::yield();
+    }
+}
@@ -0,0 +1,22 @@
+/**
+ * @file ConvexHullLoader.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "ConvexHull.h"
+
+namespace load
+{
+    /**
+     * @brief Builds a convex hull from every vertex in an object file. Hulls are cached by path and budget so
+     * that every instance of a model shares the same hull.
+     * @param path - The path to the model.
+     * @param vertexBudget - The maximum number of vertices that the hull can keep.
+     */
+    std::shared_ptr<const ConvexHull> convexHull(std::string_view path, uint32_t vertexBudget=32);
+}
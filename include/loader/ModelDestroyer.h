@@ -14,6 +14,22 @@
 
 namespace destroy
 {
+    /**
+     * @brief Gives the space of a mesh back to the mesh buffer of its vertex format and destroys its material.
+     * @tparam TVertex - The type of vertex the mesh uses.
+     * @tparam TMaterial - The type of material the mesh uses.
+     * @param meshToDestroy - The mesh that you want to destroy.
+     */
+    template<typename TVertex, typename TMaterial>
+    void mesh(Mesh<TVertex, TMaterial> &meshToDestroy)
+    {
+        meshBuffer<TVertex>().release(meshToDestroy.range);
+        meshToDestroy.range = MeshBuffer::Range();
+        meshToDestroy.renderInformation = RenderInformation();
+        
+        destroy::material(meshToDestroy.material);
+    }
+    
     /**
      * @brief Destroys all data and references to an opengl model. We can't use the destructor
      * as models could be referenced in multiple places.
@@ -24,18 +40,8 @@ namespace destroy
     template<typename TVertex, typename TMaterial>
     void model(Model<TVertex, TMaterial> &meshes)
     {
-        for (auto &mesh : meshes)
-        {
-            glDeleteVertexArrays(1, &mesh.renderInformation.vao);
-            glDeleteBuffers(1, &mesh.vbo);
-            glDeleteBuffers(1, &mesh.ebo);
-            mesh.renderInformation.vao = 0;
-            mesh.renderInformation.eboCount = 0;
-            mesh.vbo = 0;
-            mesh.ebo = 0;
-            
-            destroy::material(mesh.material);
-        }
+        for (auto &meshToDestroy : meshes)
+            destroy::mesh(meshToDestroy);
     }
     
     /**
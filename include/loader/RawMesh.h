@@ -43,6 +43,7 @@ namespace load
         [[nodiscard]] const void *verticesData() const { return static_cast<const void *>(&(mVertices.at(0))); }
         [[nodiscard]] const void *indicesData() const { return static_cast<const void *>(&(mIndices.at(0))); }
         [[nodiscard]] int indicesCount() const { return static_cast<int>(mIndices.size()); }
+        [[nodiscard]] const std::vector<TVertex> &vertices() const { return mVertices; }
     
     protected:
         std::vector<uint32_t>                       mIndices;
@@ -0,0 +1,32 @@
+/**
+ * @file AngularBenchmark.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "Physics.h"
+
+namespace physics
+{
+    struct AngularBenchmark
+    {
+        uint32_t    bodyCount               { 0 };
+        double      matrixBodiesPerMs       { 0.0 };
+        double      quaternionBodiesPerMs   { 0.0 };
+        
+        /** The relative change in rotational kinetic energy of a torque free body after driftSteps. */
+        float       matrixEnergyDrift       { 0.f };
+        float       quaternionEnergyDrift   { 0.f };
+        float       gyroscopicEnergyDrift   { 0.f };
+    };
+    
+    /**
+     * @brief Times AngularEulerMethod against AngularQuaternionMethod for bodyCount bodies where every other body is at
+     * rest. Then measures the energy drift of each method on a spinning body.
+     */
+    AngularBenchmark benchmarkAngular(uint32_t bodyCount, uint32_t steps=10, uint32_t driftSteps=1000);
+}
@@ -17,16 +17,20 @@
 #include "Shader.h"
 #include "MainCamera.h"
 #include "Components.h"
+#include "TransformHierarchy.h"
 
 /**
  * @author Ryan Purse
  * @date 20/04/2022
  */
 class BoundingVolumeVisual
-    : public ecs::BaseSystem<std::shared_ptr<BoundingVolume>, std::shared_ptr<ModelMatrix>>
+    : public ecs::BaseSystem<std::shared_ptr<BoundingVolume>, TransformNode>
 {
 public:
-    BoundingVolumeVisual(std::shared_ptr<MainCamera> camera, const unsigned int geometryBufferId);
+    BoundingVolumeVisual(
+        std::shared_ptr<MainCamera> camera, const unsigned int geometryBufferId, std::shared_ptr<TransformHierarchy> hierarchy);
+    
+    ~BoundingVolumeVisual();
     
     void drawSphere(const BoundingSphere &boundingSphere, const glm::mat4 &modelMatrix);
     
@@ -39,6 +43,12 @@ protected:
     Shader mSphereShader    { path::shaders() + "physics/SphereVolume.vert",    path::shaders() + "physics/SphereVolume.frag" };
     Shader mBoxShader       { path::shaders() + "physics/BoxVolume.vert",       path::shaders() + "physics/BoxVolume.frag" };
     
+    Shader::Uniform<glm::mat4>  mSphereModelMatrix  { mSphereShader.uniform<glm::mat4>("u_model_matrix") };
+    Shader::Uniform<float>      mSphereRadius       { mSphereShader.uniform<float>("u_radius") };
+    Shader::Uniform<glm::mat4>  mBoxModelMatrix     { mBoxShader.uniform<glm::mat4>("u_model_matrix") };
+    Shader::Uniform<glm::vec3>  mBoxHalfSize        { mBoxShader.uniform<glm::vec3>("u_halfsize") };
+    
     std::shared_ptr<MainCamera> mCamera;
+    std::shared_ptr<TransformHierarchy> mHierarchy;
     unsigned int mFbo { 0 };
 };
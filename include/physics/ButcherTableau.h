@@ -0,0 +1,208 @@
+/**
+ * @file ButcherTableau.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+
+#include <array>
+#include <utility>
+#include <tuple>
+
+/**
+ * @brief Butcher tableaux for explicit Runge-Kutta methods. a is the stage matrix (only the strictly lower triangle
+ * is used) and b holds the weights of each stage. Embedded tableaux also have bStar, the weights of a lower order
+ * solution that is only used to estimate the error of the step.
+ */
+namespace tableau
+{
+    struct Euler
+    {
+        static constexpr std::size_t stages { 1 };
+        static constexpr std::array<std::array<float, stages>, stages> a {{ { 0.f } }};
+        static constexpr std::array<float, stages> b { 1.f };
+    };
+    
+    struct Midpoint
+    {
+        static constexpr std::size_t stages { 2 };
+        static constexpr std::array<std::array<float, stages>, stages> a {{
+            { 0.f,  0.f },
+            { 0.5f, 0.f } }};
+        static constexpr std::array<float, stages> b { 0.f, 1.f };
+    };
+    
+    struct Heun
+    {
+        static constexpr std::size_t stages { 2 };
+        static constexpr std::array<std::array<float, stages>, stages> a {{
+            { 0.f, 0.f },
+            { 1.f, 0.f } }};
+        static constexpr std::array<float, stages> b { 0.5f, 0.5f };
+    };
+    
+    struct Rk4
+    {
+        static constexpr std::size_t stages { 4 };
+        static constexpr std::array<std::array<float, stages>, stages> a {{
+            { 0.f,  0.f,  0.f, 0.f },
+            { 0.5f, 0.f,  0.f, 0.f },
+            { 0.f,  0.5f, 0.f, 0.f },
+            { 0.f,  0.f,  1.f, 0.f } }};
+        static constexpr std::array<float, stages> b { 1.f / 6.f, 1.f / 3.f, 1.f / 3.f, 1.f / 6.f };
+    };
+    
+    /** Kutta's 3/8 rule. */
+    struct Rk38
+    {
+        static constexpr std::size_t stages { 4 };
+        static constexpr std::array<std::array<float, stages>, stages> a {{
+            { 0.f,        0.f, 0.f, 0.f },
+            { 1.f / 3.f,  0.f, 0.f, 0.f },
+            { -1.f / 3.f, 1.f, 0.f, 0.f },
+            { 1.f,       -1.f, 1.f, 0.f } }};
+        static constexpr std::array<float, stages> b { 1.f / 8.f, 3.f / 8.f, 3.f / 8.f, 1.f / 8.f };
+    };
+    
+    /** Bogacki-Shampine 3(2). */
+    struct BogackiShampine
+    {
+        static constexpr std::size_t stages { 4 };
+        static constexpr uint32_t embeddedOrder { 2 };
+        static constexpr std::array<std::array<float, stages>, stages> a {{
+            { 0.f,       0.f,       0.f,       0.f },
+            { 0.5f,      0.f,       0.f,       0.f },
+            { 0.f,       0.75f,     0.f,       0.f },
+            { 2.f / 9.f, 1.f / 3.f, 4.f / 9.f, 0.f } }};
+        static constexpr std::array<float, stages> b { 2.f / 9.f, 1.f / 3.f, 4.f / 9.f, 0.f };
+        static constexpr std::array<float, stages> bStar { 7.f / 24.f, 1.f / 4.f, 1.f / 3.f, 1.f / 8.f };
+    };
+    
+    /** Dormand-Prince 5(4). The fifth order solution is kept. */
+    struct DormandPrince
+    {
+        static constexpr std::size_t stages { 7 };
+        static constexpr uint32_t embeddedOrder { 4 };
+        static constexpr std::array<std::array<float, stages>, stages> a {{
+            { 0.f,                0.f,                 0.f,                0.f,              0.f,                0.f,          0.f },
+            { 1.f / 5.f,          0.f,                 0.f,                0.f,              0.f,                0.f,          0.f },
+            { 3.f / 40.f,         9.f / 40.f,          0.f,                0.f,              0.f,                0.f,          0.f },
+            { 44.f / 45.f,        -56.f / 15.f,        32.f / 9.f,         0.f,              0.f,                0.f,          0.f },
+            { 19372.f / 6561.f,   -25360.f / 2187.f,   64448.f / 6561.f,   -212.f / 729.f,   0.f,                0.f,          0.f },
+            { 9017.f / 3168.f,    -355.f / 33.f,       46732.f / 5247.f,   49.f / 176.f,     -5103.f / 18656.f,  0.f,          0.f },
+            { 35.f / 384.f,       0.f,                 500.f / 1113.f,     125.f / 192.f,    -2187.f / 6784.f,   11.f / 84.f,  0.f } }};
+        static constexpr std::array<float, stages> b {
+            35.f / 384.f, 0.f, 500.f / 1113.f, 125.f / 192.f, -2187.f / 6784.f, 11.f / 84.f, 0.f };
+        static constexpr std::array<float, stages> bStar {
+            5179.f / 57600.f, 0.f, 7571.f / 16695.f, 393.f / 640.f, -92097.f / 339200.f, 187.f / 2100.f, 1.f / 40.f };
+    };
+}
+
+namespace physics
+{
+    namespace detail
+    {
+        template<typename TFunction, std::size_t... Indices>
+        constexpr void unroll(TFunction &&function, std::index_sequence<Indices...>)
+        {
+            (function(std::integral_constant<std::size_t, Indices>()), ...);
+        }
+    }
+    
+    /**
+     * @brief Calls function once for each index in [0, count), passing the index as a std::integral_constant.
+     */
+    template<std::size_t count, typename TFunction>
+    constexpr void unroll(TFunction &&function)
+    {
+        detail::unroll(std::forward<TFunction>(function), std::make_index_sequence<count>());
+    }
+    
+    /**
+     * @brief Takes a single step of dx/dt = p / m, dp/dt = F with an explicit Runge-Kutta method. Every stage is
+     * unrolled at compile time and any zero coefficient is skipped. The force is held constant over the step.
+     */
+    template<typename TTableau>
+    void rungeKutta(glm::vec3 &position, glm::vec3 &momentum, const glm::vec3 &force, const float mass, const float h)
+    {
+        constexpr std::size_t stages = TTableau::stages;
+        std::array<glm::vec3, stages> kPosition;
+        std::array<glm::vec3, stages> kMomentum;
+        
+        unroll<stages>([&](auto i) {
+            constexpr std::size_t stage = decltype(i)::value;
+            glm::vec3 stageMomentum = momentum;
+            unroll<stage>([&](auto j) {
+                constexpr std::size_t previous = decltype(j)::value;
+                if constexpr (TTableau::a[stage][previous] != 0.f)
+                    stageMomentum += h * TTableau::a[stage][previous] * kMomentum[previous];
+            });
+            kPosition[stage] = stageMomentum / mass;
+            kMomentum[stage] = force;
+        });
+        
+        unroll<stages>([&](auto i) {
+            constexpr std::size_t stage = decltype(i)::value;
+            if constexpr (TTableau::b[stage] != 0.f)
+            {
+                position += h * TTableau::b[stage] * kPosition[stage];
+                momentum += h * TTableau::b[stage] * kMomentum[stage];
+            }
+        });
+    }
+    
+    struct EmbeddedError
+    {
+        glm::vec3 position { 0.f };
+        glm::vec3 momentum { 0.f };
+    };
+    
+    /**
+     * @brief Takes a single step of an embedded Runge-Kutta method where the force may depend on the current state.
+     * @param derivative - Called as derivative(position, momentum) and returns the std::pair { dx/dt, dp/dt }.
+     * @returns The difference between the two solutions of the tableau, which estimates the local error of the step.
+     */
+    template<typename TTableau, typename TDerivative>
+    EmbeddedError embeddedRungeKutta(glm::vec3 &position, glm::vec3 &momentum, const float h, TDerivative &&derivative)
+    {
+        constexpr std::size_t stages = TTableau::stages;
+        std::array<glm::vec3, stages> kPosition;
+        std::array<glm::vec3, stages> kMomentum;
+        
+        unroll<stages>([&](auto i) {
+            constexpr std::size_t stage = decltype(i)::value;
+            glm::vec3 stagePosition = position;
+            glm::vec3 stageMomentum = momentum;
+            unroll<stage>([&](auto j) {
+                constexpr std::size_t previous = decltype(j)::value;
+                if constexpr (TTableau::a[stage][previous] != 0.f)
+                {
+                    stagePosition += h * TTableau::a[stage][previous] * kPosition[previous];
+                    stageMomentum += h * TTableau::a[stage][previous] * kMomentum[previous];
+                }
+            });
+            std::tie(kPosition[stage], kMomentum[stage]) = derivative(stagePosition, stageMomentum);
+        });
+        
+        EmbeddedError error;
+        unroll<stages>([&](auto i) {
+            constexpr std::size_t stage = decltype(i)::value;
+            if constexpr (TTableau::b[stage] != 0.f)
+            {
+                position += h * TTableau::b[stage] * kPosition[stage];
+                momentum += h * TTableau::b[stage] * kMomentum[stage];
+            }
+            if constexpr (TTableau::b[stage] != TTableau::bStar[stage])
+            {
+                error.position += h * (TTableau::b[stage] - TTableau::bStar[stage]) * kPosition[stage];
+                error.momentum += h * (TTableau::b[stage] - TTableau::bStar[stage]) * kMomentum[stage];
+            }
+        });
+        
+        return error;
+    }
+}
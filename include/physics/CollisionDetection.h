@@ -14,26 +14,26 @@
 #include "PhysicsHelpers.h"
 #include "physics/components/Physics.h"
 #include "physics/octree/Tree.h"
-
-class Renderer;
+#include "Gjk.h"
+#include "TransformHierarchy.h"
 
 /**
  * @author Ryan Purse
  * @date 20/04/2022
  */
 class CollisionDetection
-    : public ecs::BaseSystem<std::shared_ptr<BoundingVolume>, std::shared_ptr<ModelMatrix>, Velocity>
+    : public ecs::BaseSystem<std::shared_ptr<BoundingVolume>, TransformNode, Velocity>
 {
     struct BoundedCollisionEntity
     {
         std::shared_ptr<BoundingVolume> boundingVolume;
-        std::shared_ptr<ModelMatrix>  basicUniforms;
+        TransformNode                   node;
         Velocity                        velocity;
         octree::AABB                    bounds;
     };
     
 public:
-    CollisionDetection(Renderer &renderer, std::shared_ptr<octree::Tree<CollisionEntity>> tree);
+    CollisionDetection(std::shared_ptr<octree::Tree<CollisionEntity>> tree, std::shared_ptr<TransformHierarchy> hierarchy);
     
     /** Sphere Vs. Sphere */
     HitRecord collisionCheck(
@@ -50,18 +50,43 @@ public:
         const BoundingBox &lhs, const glm::mat4 &lhsModelMat, const glm::vec3 &lhsVelocity,
         const BoundingBox &rhs, const glm::mat4 &rhsModelMat, const glm::vec3 &rhsVelocity);
     
+    /** Hull Vs. Sphere */
+    HitRecord collisionCheck(
+        const BoundingConvexHull &lhs, const glm::mat4 &lhsModelMat, const glm::vec3 &lhsVelocity,
+        const BoundingSphere &rhs,     const glm::mat4 &rhsModelMat, const glm::vec3 &rhsVelocity);
+    
+    /** Hull Vs. Box */
+    HitRecord collisionCheck(
+        const BoundingConvexHull &lhs, const glm::mat4 &lhsModelMat, const glm::vec3 &lhsVelocity,
+        const BoundingBox &rhs,        const glm::mat4 &rhsModelMat, const glm::vec3 &rhsVelocity);
+    
+    /** Hull Vs. Hull */
+    HitRecord collisionCheck(
+        const BoundingConvexHull &lhs, const glm::mat4 &lhsModelMat, const glm::vec3 &lhsVelocity,
+        const BoundingConvexHull &rhs, const glm::mat4 &rhsModelMat, const glm::vec3 &rhsVelocity);
+    
 protected:
+    /**
+     * @brief Runs gjk on the two shapes and epa if they are overlapping.
+     * @returns A hit on the surface of lhs, with a normal pointing from lhs towards rhs.
+     */
+    HitRecord convexCheck(const gjk::Shape &lhs, const gjk::Shape &rhs);
+    
+    void traverseTree(
+        std::shared_ptr<BoundingSphere> lhsEntity, const TransformNode &node,
+        const Velocity &velocity, octree::AABB bounds);
+    
     void traverseTree(
-        std::shared_ptr<BoundingSphere> lhsEntity, std::shared_ptr<ModelMatrix> &uniforms,
+        std::shared_ptr<BoundingBox> lhsEntity, const TransformNode &node,
         const Velocity &velocity, octree::AABB bounds);
     
     void traverseTree(
-        std::shared_ptr<BoundingBox> lhsEntity, std::shared_ptr<ModelMatrix> &uniforms,
+        std::shared_ptr<BoundingConvexHull> lhsEntity, const TransformNode &node,
         const Velocity &velocity, octree::AABB bounds);
     
     std::vector<BoundedCollisionEntity> mCollisionEntities;
     std::shared_ptr<octree::Tree<CollisionEntity>> mTree;
-    Renderer &mRenderer;
+    std::shared_ptr<TransformHierarchy> mHierarchy;
 };
 
 
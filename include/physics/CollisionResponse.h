@@ -10,6 +10,8 @@
 #include "Pch.h"
 #include "Ecs.h"
 
+class ConvexHull;
+
 /**
  * A collection of collision based responses that are tied to a specific scene.
  * @author Ryan Purse
@@ -26,6 +28,7 @@ public:
     
     void makeBoundingBox(const Entity entity, const bool isDynamic = true, const glm::vec3 &halfSize = glm::vec3(1.f));
     void makeBoundingSphere(const Entity entity, const bool isDynamic = true, const float radius = 1.f);
+    void makeConvexHull(const Entity entity, std::shared_ptr<const ConvexHull> hull, const bool isDynamic = true);
     
     void response(Entity entity, Entity other, const glm::vec3 &position, const glm::vec3 &normal);
     
@@ -34,6 +37,12 @@ public:
     void typedStaticCollision(Component dynamicType, Entity entity, Entity other, const glm::vec3 &position, const glm::vec3 &normal);
     
     void dynamicCollision(Entity entity, Entity other, const glm::vec3 &position, const glm::vec3 &normal);
+    
+    /**
+     * @brief The same as response() but for hits that always report the normal pointing out of the other body.
+     * dynamicCollision() wants the normal pointing towards the other body, so it is flipped for that case.
+     */
+    void pushOutResponse(Entity entity, Entity other, const glm::vec3 &position, const glm::vec3 &normal);
 protected:
     ecs::Core &mEcs;
     
@@ -0,0 +1,57 @@
+/**
+ * @file ConvexHull.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+
+/**
+ * @brief The vertices of a convex hull, stored as a structure of arrays so that the support function can be
+ * evaluated a whole lane of vertices at a time. Each array is padded up to a multiple of laneWidth with copies of
+ * the first vertex, so the support loop never needs a scalar tail.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class ConvexHull
+{
+public:
+    static constexpr uint32_t laneWidth { 8 };
+    
+    ConvexHull() = default;
+    
+    /**
+     * @brief Builds the hull using quickhull. Expansion always picks the point furthest outside of the current
+     * hull, so stopping at the vertex budget keeps the most significant vertices of the shape.
+     * @param points - The point cloud, normally the vertices of a mesh.
+     * @param vertexBudget - The maximum number of vertices kept by the hull (at least 4).
+     */
+    ConvexHull(const std::vector<glm::vec3> &points, uint32_t vertexBudget);
+    
+    /**
+     * @returns The vertex of the hull that is the furthest along direction (in local space).
+     */
+    [[nodiscard]] glm::vec3 support(const glm::vec3 &direction) const;
+    
+    [[nodiscard]] glm::vec3 vertex(uint32_t index) const { return { mX[index], mY[index], mZ[index] }; }
+    [[nodiscard]] uint32_t vertexCount() const { return mVertexCount; }
+    
+    /** The centre of the local space box that contains the hull. */
+    [[nodiscard]] const glm::vec3 &centre() const { return mCentre; }
+    
+    /** The half size of the local space box that contains the hull. */
+    [[nodiscard]] const glm::vec3 &halfSize() const { return mHalfSize; }
+
+protected:
+    void setVertices(const std::vector<glm::vec3> &vertices);
+    
+    std::vector<float>  mX;
+    std::vector<float>  mY;
+    std::vector<float>  mZ;
+    uint32_t            mVertexCount    { 0 };
+    glm::vec3           mCentre         { 0.f };
+    glm::vec3           mHalfSize       { 0.f };
+};
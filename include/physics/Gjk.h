@@ -0,0 +1,95 @@
+/**
+ * @file Gjk.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "ConvexHull.h"
+
+#include <array>
+
+/**
+ * @brief Gilbert-Johnson-Keerthi distance and intersection tests between any two convex shapes, with the
+ * Expanding Polytope Algorithm to find how far they are overlapping.
+ */
+namespace gjk
+{
+    /**
+     * @brief A convex shape that is placed into world space by a model matrix. Only the support function is
+     * needed by gjk, so spheres, boxes and hulls can all be tested against each other.
+     */
+    class Shape
+    {
+    public:
+        Shape(const ConvexHull &hull, const glm::mat4 &modelMatrix);
+        Shape(const glm::vec3 &halfSize, const glm::mat4 &modelMatrix);
+        Shape(float radius, const glm::mat4 &modelMatrix);
+        
+        /**
+         * @returns The point on the shape that is the furthest along direction (in world space).
+         */
+        [[nodiscard]] glm::vec3 support(const glm::vec3 &direction) const;
+        
+        [[nodiscard]] glm::vec3 centre() const { return mModelMatrix[3]; }
+    
+    protected:
+        const ConvexHull    *mHull      { nullptr };
+        glm::vec3           mHalfSize   { 0.f };
+        float               mRadius     { 0.f };
+        glm::mat4           mModelMatrix;
+        glm::mat3           mToLocal;
+    };
+    
+    /** A point on the Minkowski difference, along with the points on each shape that made it. */
+    struct SupportPoint
+    {
+        glm::vec3 point;
+        glm::vec3 onA;
+        glm::vec3 onB;
+    };
+    
+    struct Simplex
+    {
+        std::array<SupportPoint, 4> points;
+        uint32_t size { 0 };
+    };
+    
+    struct DistanceResult
+    {
+        bool        intersecting    { false };
+        float       distance        { 0.f };
+        glm::vec3   pointA          { 0.f };
+        glm::vec3   pointB          { 0.f };
+        Simplex     simplex;
+    };
+    
+    struct PenetrationResult
+    {
+        /** From shape A towards shape B. Moving B by normal * depth separates the shapes. */
+        glm::vec3   normal      { 0.f, 1.f, 0.f };
+        float       depth       { 0.f };
+        glm::vec3   pointA      { 0.f };
+        glm::vec3   pointB      { 0.f };
+    };
+    
+    /**
+     * @brief Finds the closest points between two shapes.
+     * @returns intersecting is set if the shapes overlap. Otherwise, the distance and the closest points on both shapes.
+     */
+    DistanceResult distance(const Shape &a, const Shape &b);
+    
+    /**
+     * @returns True if the two shapes overlap.
+     */
+    bool intersect(const Shape &a, const Shape &b);
+    
+    /**
+     * @brief Expands the simplex from an intersecting distance query to find the penetration depth and normal.
+     * @param simplex - The simplex that gjk terminated with when it found an intersection.
+     */
+    PenetrationResult penetration(const Shape &a, const Shape &b, const Simplex &simplex);
+}
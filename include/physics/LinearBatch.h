@@ -0,0 +1,107 @@
+/**
+ * @file LinearBatch.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+
+class DynamicObject;
+class Velocity;
+class Position;
+
+/**
+ * @brief How much of a tick goes into each term of an explicit Runge-Kutta step when the force is held constant over
+ * it, as physics::rungeKutta does. Stage i then sees the momentum p + h c_i F, where c_i is the sum of row i of a, so
+ * every tableau collapses to x += (h sum(b) p + h^2 sum(b_i c_i) F) / m and p += h sum(b) F.
+ */
+struct LinearBatchWeights
+{
+    float momentum  { 1.f };
+    float force     { 0.f };
+    
+    template<typename TTableau>
+    static constexpr LinearBatchWeights of()
+    {
+        LinearBatchWeights weights { 0.f, 0.f };
+        for (std::size_t stage = 0; stage < TTableau::stages; ++stage)
+        {
+            float c = 0.f;
+            for (std::size_t previous = 0; previous < stage; ++previous)
+                c += TTableau::a[stage][previous];
+            
+            weights.momentum += TTableau::b[stage];
+            weights.force += TTableau::b[stage] * c;
+        }
+        return weights;
+    }
+};
+
+/**
+ * @brief A structure of arrays copy of the linear state of many bodies. Bodies are gathered one at a time, integrated
+ * together (eight at a time with AVX2) and then scattered back in the same order. Only integrators whose force is
+ * constant over the tick can be batched, so LinearRkN and the adaptive methods stay per entity.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class LinearBatch
+{
+public:
+    static constexpr uint32_t laneWidth { 8 };
+    
+    void clear();
+    
+    void gather(const DynamicObject &dynamicObject, const Position &position);
+    
+    /**
+     * @brief Takes the same step as LinearRk<TTableau> for every body when weights is
+     * LinearBatchWeights::of<TTableau>(). The default weights are those of Euler. Uses AVX2 when the compiler targets
+     * it, otherwise falls back to integrateScalar().
+     */
+    void integrate(float deltaTime, const LinearBatchWeights &weights={});
+    
+    void integrateScalar(float deltaTime, const LinearBatchWeights &weights={});
+    
+    /**
+     * @brief Writes the integrated position and momentum of a body back. The velocity is worked out from the momentum
+     * like LinearRk does, as collision reads it, and the force is cleared. Mass is never changed so it is not written.
+     */
+    void scatter(uint32_t index, DynamicObject &dynamicObject, Velocity &velocity, Position &position) const;
+    
+    [[nodiscard]] uint32_t size() const { return mSize; }
+
+protected:
+    void integrateRange(uint32_t first, uint32_t last, float deltaTime, const LinearBatchWeights &weights);
+    
+    std::vector<float> mPositionX;
+    std::vector<float> mPositionY;
+    std::vector<float> mPositionZ;
+    std::vector<float> mMomentumX;
+    std::vector<float> mMomentumY;
+    std::vector<float> mMomentumZ;
+    std::vector<float> mForceX;
+    std::vector<float> mForceY;
+    std::vector<float> mForceZ;
+    std::vector<float> mInverseMass;
+    uint32_t mSize { 0 };
+};
+
+namespace physics
+{
+    struct LinearBatchBenchmark
+    {
+        uint32_t    bodyCount               { 0 };
+        double      perEntityBodiesPerMs    { 0.0 };
+        double      scalarBatchBodiesPerMs  { 0.0 };
+        double      simdBatchBodiesPerMs    { 0.0 };
+    };
+    
+    /**
+     * @brief Times the per-entity Euler update against the gather, integrate and scatter path for bodyCount bodies.
+     * The batch timings include the gather and scatter so that the comparison is fair.
+     */
+    LinearBatchBenchmark benchmarkLinearBatch(uint32_t bodyCount, uint32_t steps=10);
+}
@@ -33,7 +33,7 @@ struct HitRecord
 struct CollisionEntity
 {
     std::shared_ptr<BoundingVolume> boundingVolume;
-    std::shared_ptr<ModelMatrix>  basicUniforms;
+    TransformNode                   node;
     Velocity                        velocity;
 };
 
@@ -62,6 +62,28 @@ namespace physics
     
     std::array<glm::vec3, 8> boxToVertex(const glm::mat4 &modelMatrix, const glm::vec3 &halfSize);
     
+    /**
+     * @brief Finds the world space axis aligned box that contains a transformed local box.
+     * @param modelMatrix - Transforms the local box into world space.
+     * @param centre - The centre of the local box.
+     * @param halfSize - The half size of the local box.
+     * @returns The centre and half size of the world space box.
+     */
+    std::pair<glm::vec3, glm::vec3> axisAlignedBounds(const glm::mat4 &modelMatrix, const glm::vec3 &centre, const glm::vec3 &halfSize);
+    
+    /**
+     * @brief Rotates orientation by a constant angular velocity over time with the exponential map. The result is
+     * always a unit quaternion, so it never has to go through a matrix.
+     */
+    glm::quat integrateOrientation(const glm::quat &orientation, const glm::vec3 &angularVelocity, float time);
+    
+    /**
+     * @brief One Newton iteration of the implicit gyroscopic term (w x Iw), solved in body space. Keeps fast
+     * spinning, thin bodies stable at the cost of a little energy.
+     * @returns The corrected world space angular velocity.
+     */
+    glm::vec3 solveGyroscopic(const glm::quat &orientation, const glm::mat3 &bodyInertia, const glm::vec3 &angularVelocity, float time);
+    
     constexpr glm::vec3 calculateMomentum(const float time, const glm::vec3 &force) { return force * time; };
 }
 
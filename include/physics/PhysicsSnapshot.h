@@ -0,0 +1,94 @@
+/**
+ * @file PhysicsSnapshot.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "Ecs.h"
+
+#include <optional>
+
+class TransformHierarchy;
+
+/**
+ * @brief A body whose state is kept in a snapshot. Bodies whose DynamicObject is in a typed channel (e.g., the balls
+ * of the ODE demo) must give that type, as the channel cannot be found from the entity alone.
+ */
+struct SnapshotBody
+{
+    Entity                      entity;
+    std::optional<Component>    dynamicType;
+};
+
+/**
+ * @brief A compact binary copy of every physics-relevant component of a set of bodies (transform, velocity,
+ * dynamic and angular state, torque, adaptive step and collider shape). Bodies are written in the order they are
+ * given with a mask of which components each one has, so capture and restore are a single pass of memcpys.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class PhysicsSnapshot
+{
+public:
+    void capture(ecs::Core &ecs, const std::vector<SnapshotBody> &bodies, uint64_t tick);
+    
+    /**
+     * @brief Writes the state back into the same bodies that it was captured from and rebuilds their world matrices in
+     * hierarchy, so that collision detection sees the restored transforms on the next tick.
+     */
+    void restore(ecs::Core &ecs, const std::vector<SnapshotBody> &bodies, TransformHierarchy &hierarchy) const;
+    
+    [[nodiscard]] uint64_t tick() const { return mTick; }
+    [[nodiscard]] std::size_t bytes() const { return mData.size(); }
+    [[nodiscard]] const std::vector<std::byte> &data() const { return mData; }
+    
+    /**
+     * @returns True if both snapshots are bit for bit the same.
+     */
+    bool operator==(const PhysicsSnapshot &other) const;
+    bool operator!=(const PhysicsSnapshot &other) const { return !(*this == other); }
+
+protected:
+    std::vector<std::byte>  mData;
+    uint64_t                mTick { 0 };
+};
+
+/** A force that was applied to a body from outside of the simulation before a tick was run. */
+struct PhysicsInput
+{
+    uint64_t    tick    { 0 };
+    uint32_t    body    { 0 };
+    glm::vec3   force   { 0.f };
+};
+
+/** Everything needed to replay a run: the state it started from and every input in tick order. */
+struct PhysicsRecording
+{
+    PhysicsSnapshot             start;
+    std::vector<PhysicsInput>   inputs;
+    uint64_t                    ticks { 0 };
+};
+
+namespace physics
+{
+    struct SnapshotBenchmark
+    {
+        uint32_t    bodyCount       { 0 };
+        std::size_t bytes           { 0 };
+        double      captureMs       { 0.0 };
+        double      restoreMs       { 0.0 };
+        
+        /** Whether replaying a recording of a smaller world gave exactly the same final state as the original run. */
+        bool        replayMatches   { false };
+    };
+    
+    /**
+     * @brief Times capturing and restoring a snapshot of bodyCount spheres, then records a short run with inputs and
+     * checks that replaying it is bit exact.
+     */
+    SnapshotBenchmark benchmarkSnapshot(uint32_t bodyCount, uint32_t steps=10);
+}
@@ -10,14 +10,10 @@
 #include "Pch.h"
 #include "Ecs.h"
 #include "Timers.h"
-
-class DynamicObject;
-class Velocity;
-class Transform;
-class Kinematic;
-class AngularVelocity;
-class Torque;
-class AngularObject;
+#include "LinearBatch.h"
+#include "ButcherTableau.h"
+#include "Physics.h"
+#include "Components.h"
 
 
 class Gravity
@@ -25,53 +21,249 @@ class Gravity
 {
 public:
     Gravity();
+    
+    static void apply(DynamicObject &dynamicObject);
+    
 protected:
-    const float gravitationalConstant { 9.81f };
+    static constexpr float gravitationalConstant { 9.81f };
 };
 
 
-class LinearEulerMethod
-    : public ecs::BaseSystem<DynamicObject, Velocity, Transform>
+/**
+ * @brief Copies the linear state of every body into a LinearBatch ready for LinearBatchIntegrator.
+ */
+class LinearBatchGather
+    : public ecs::BaseSystem<DynamicObject, Velocity, Position>
 {
 public:
-    LinearEulerMethod();
+    explicit LinearBatchGather(std::shared_ptr<LinearBatch> batch);
+    
+    void onUpdate() override;
+
+protected:
+    std::shared_ptr<LinearBatch> mBatch;
 };
 
+/**
+ * @brief The same integration as LinearRk<TTableau>, but done on the whole batch at once. Must be created with the
+ * same tags straight after a LinearBatchGather that shares its batch, so both systems visit entities in the same order.
+ */
+template<typename TTableau>
+class LinearBatchIntegrator
+    : public ecs::BaseSystem<DynamicObject, Velocity, Position>
+{
+public:
+    explicit LinearBatchIntegrator(std::shared_ptr<LinearBatch> batch)
+        : mBatch(std::move(batch))
+    {
+        mEntities.forEach([this](DynamicObject &dynamicObject, Velocity &velocity, Position &position) {
+            if (mIndex < mBatch->size())
+                mBatch->scatter(mIndex++, dynamicObject, velocity, position);
+        });
+        scheduleFor(ecs::FixedUpdate);
+    }
+    
+    void onUpdate() override
+    {
+        mBatch->integrate(timers::fixedTime<float>(), weights);
+        mIndex = 0;
+    }
+
+protected:
+    static constexpr LinearBatchWeights weights { LinearBatchWeights::of<TTableau>() };
+    
+    std::shared_ptr<LinearBatch> mBatch;
+    uint32_t mIndex { 0 };
+};
+
+using LinearBatchEuler  = LinearBatchIntegrator<tableau::Euler>;
+using LinearBatchRk2    = LinearBatchIntegrator<tableau::Midpoint>;
+using LinearBatchRk4    = LinearBatchIntegrator<tableau::Rk4>;
+
 class LinearKinematicSystem
-    : public ecs::BaseSystem<Kinematic, Velocity, Transform>
+    : public ecs::BaseSystem<Kinematic, Velocity, Position>
 {
 public:
     LinearKinematicSystem();
+    
+    static void integrate(const Kinematic &kinematic, const Velocity &velocity, Position &position, float deltaTime);
 };
 
 class AngularEulerMethod
-    : public ecs::BaseSystem<Torque, AngularObject, AngularVelocity, Transform>
+    : public ecs::BaseSystem<Torque, AngularObject, AngularVelocity, Rotation>
 {
 public:
     AngularEulerMethod();
+    
+    static void integrate(Torque &torque, AngularObject &angularObject, AngularVelocity &angularVelocity, Rotation &rotation);
 };
 
-class LinearRk4
-    : public ecs::BaseSystem<DynamicObject, Velocity, Transform>
+/**
+ * @brief Integrates the orientation as a quaternion with the exponential map. The world inverse inertia is only
+ * recalculated for bodies that have rotated since it was last calculated.
+ */
+class AngularQuaternionMethod
+    : public ecs::BaseSystem<Torque, AngularObject, AngularVelocity, Rotation>
 {
 public:
-    LinearRk4();
+    explicit AngularQuaternionMethod(bool gyroscopic=false);
+    
+    static void integrate(
+        Torque &torque, AngularObject &angularObject, AngularVelocity &angularVelocity,
+        glm::quat &rotation, bool gyroscopic);
+
+protected:
+    const bool mGyroscopic;
 };
 
-class LinearRk2
-    : public ecs::BaseSystem<DynamicObject, Velocity, Transform>
+/**
+ * @brief Integrates the position and momentum of each body with the explicit Runge-Kutta method described by TTableau.
+ */
+template<typename TTableau>
+class LinearRk
+    : public ecs::BaseSystem<DynamicObject, Velocity, Position>
 {
 public:
-    LinearRk2();
+    LinearRk()
+    {
+        mEntities.forEach([](DynamicObject &dynamicObject, Velocity &velocity, Position &position) {
+            integrate(dynamicObject, velocity, position);
+        });
+        scheduleFor(ecs::FixedUpdate);
+    }
+    
+    static void integrate(DynamicObject &dynamicObject, Velocity &velocity, Position &position)
+    {
+        auto &[force, mass, momentum] = dynamicObject;
+        
+        physics::rungeKutta<TTableau>(position.value, momentum, force, mass, timers::fixedTime<float>());
+        velocity.value = momentum / mass;
+        
+        force = glm::vec3(0.f);  // Reset the forces for the next frame.
+    }
 };
 
-class LinearRk
-    : public ecs::BaseSystem<DynamicObject, Velocity, Transform>
+using LinearEulerMethod = LinearRk<tableau::Euler>;
+using LinearRk2         = LinearRk<tableau::Midpoint>;
+using LinearRk4         = LinearRk<tableau::Rk4>;
+
+/**
+ * @brief Integrates bodies whose force changes over the tick (currently a Spring on top of the constant forces in
+ * DynamicObject). Each fixed tick is split into as many substeps as the error estimate of TTableau needs to stay
+ * within the tolerance of the body.
+ */
+template<typename TTableau>
+class LinearAdaptiveRk
+    : public ecs::BaseSystem<DynamicObject, Velocity, Position, Spring, AdaptiveStep>
+{
+public:
+    LinearAdaptiveRk()
+    {
+        mEntities.forEach([](DynamicObject &dynamicObject, Velocity &velocity, Position &position, const Spring &spring, AdaptiveStep &adaptiveStep) {
+            integrate(dynamicObject, velocity, position, spring, adaptiveStep);
+        });
+        scheduleFor(ecs::FixedUpdate);
+    }
+    
+    static void integrate(DynamicObject &dynamicObject, Velocity &velocity, Position &position, const Spring &spring, AdaptiveStep &adaptiveStep)
+    {
+        auto &[force, mass, momentum] = dynamicObject;
+        
+        const auto derivative = [&](const glm::vec3 &stagePosition, const glm::vec3 &stageMomentum) {
+            const glm::vec3 stageVelocity = stageMomentum / mass;
+            const glm::vec3 offset = stagePosition - spring.anchor;
+            const float length = glm::length(offset);
+            
+            glm::vec3 stageForce = force - spring.damping * stageVelocity;
+            if (length > 0.f)
+                stageForce -= spring.stiffness * (length - spring.restLength) * (offset / length);
+            
+            return std::make_pair(stageVelocity, stageForce);
+        };
+        
+        const float fixedTime = timers::fixedTime<float>();
+        const float minimumStep = fixedTime / static_cast<float>(maxSubsteps);
+        float remaining = fixedTime;
+        float proposed = adaptiveStep.step > 0.f ? adaptiveStep.step : fixedTime;
+        
+        while (remaining > 0.f)
+        {
+            const float h = glm::min(glm::max(proposed, minimumStep), remaining);
+            
+            glm::vec3 nextPosition = position.value;
+            glm::vec3 nextMomentum = momentum;
+            const physics::EmbeddedError error = physics::embeddedRungeKutta<TTableau>(nextPosition, nextMomentum, h, derivative);
+            const float errorRatio = glm::max(glm::length(error.position), glm::length(error.momentum) / mass) / adaptiveStep.tolerance;
+            
+            const float scale = errorRatio > 0.f
+                ? 0.9f * glm::pow(errorRatio, -1.f / static_cast<float>(TTableau::embeddedOrder + 1))
+                : maxGrowth;
+            const float next = h * glm::clamp(scale, minShrink, maxGrowth);
+            
+            // Substeps at the minimum size are always accepted so that a tick can never stall.
+            if (errorRatio <= 1.f || h <= minimumStep)
+            {
+                position.value = nextPosition;
+                momentum = nextMomentum;
+                remaining -= h;
+                ++adaptiveStep.acceptedSteps;
+                
+                // A step cut short by the end of the tick says nothing about the size the next one can be.
+                if (h >= proposed)
+                    proposed = next;
+            }
+            else
+            {
+                ++adaptiveStep.rejectedSteps;
+                proposed = next;
+            }
+        }
+        adaptiveStep.step = proposed;
+        
+        velocity.value = momentum / mass;
+        force = glm::vec3(0.f);  // Reset the forces for the next frame.
+    }
+
+protected:
+    static constexpr uint32_t maxSubsteps { 64 };
+    static constexpr float minShrink { 0.2f };
+    static constexpr float maxGrowth { 5.f };
+};
+
+using LinearBogackiShampine = LinearAdaptiveRk<tableau::BogackiShampine>;
+using LinearDormandPrince   = LinearAdaptiveRk<tableau::DormandPrince>;
+
+/**
+ * @brief A runtime order rk method where the weight of each stage comes from the binomial coefficients.
+ */
+class LinearRkN
+    : public ecs::BaseSystem<DynamicObject, Velocity, Position>
 {
 public:
-    explicit LinearRk(const uint32_t degree);
+    explicit LinearRkN(const uint32_t degree);
+    
+    static std::vector<float> binomials(uint32_t degree);
+    
+    static void integrate(
+        const std::vector<float> &binomials, float sum,
+        DynamicObject &dynamicObject, Velocity &velocity, Position &position);
+
 protected:
     std::vector<float> mBinomials;
     float mSum { 0.f };
-    const uint32_t mDegree;
 };
+
+namespace physics
+{
+    struct RungeKuttaBenchmark
+    {
+        uint32_t    bodyCount           { 0 };
+        double      templatedBodiesPerMs { 0.0 };
+        double      runtimeBodiesPerMs  { 0.0 };
+    };
+    
+    /**
+     * @brief Times LinearRk4 against LinearRkN of degree 4 over bodyCount bodies set up like the ode demo.
+     */
+    RungeKuttaBenchmark benchmarkRungeKutta(uint32_t bodyCount, uint32_t steps=10);
+}
@@ -0,0 +1,107 @@
+/**
+ * @file PhysicsWorld.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "Ecs.h"
+#include "CollisionResponse.h"
+#include "physics/octree/Tree.h"
+#include "Timers.h"
+#include "PhysicsSnapshot.h"
+#include "TransformHierarchy.h"
+
+class CollisionEntity;
+
+/**
+ * @brief The ecs and physics of a scene without anything that needs a window or an OpenGL context, so that
+ * simulations can be run on machines without a display.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class PhysicsWorld
+{
+public:
+    PhysicsWorld();
+    
+    /**
+     * @brief Creates an entity with a transform and the node in the hierarchy that collision detection reads from.
+     */
+    Entity createBody(const glm::vec3 &position);
+    
+    Entity createSphere(const glm::vec3 &position, float mass=100.f, float bounciness=0.2f, float radius=1.f);
+    
+    /**
+     * @brief Creates a sphere whose DynamicObject is in the channel of type, so that only systems created with that
+     * type will integrate it (the same as the balls of the ODE demo).
+     */
+    Entity createSphere(const glm::vec3 &position, Component type, float mass=100.f, float bounciness=0.9f);
+    
+    /**
+     * @brief Creates the same 100x100 static floor that the demo scenes use.
+     */
+    Entity createFloor();
+    
+    /**
+     * @brief Creates the tree builder and collision detection. Must be called before any integrators are created.
+     */
+    void createCollisionSystems();
+    
+    /**
+     * @brief Runs a single fixed update with this world's fixed time, then updates the model matrices ready for the
+     * next one.
+     */
+    void step();
+    
+    /**
+     * @brief Adds force to the DynamicObject of the body'th body created by this world before the next tick. The
+     * force is kept if recording so that it can be replayed. Bodies that do not exist or are static are skipped with
+     * a warning.
+     */
+    void applyForce(uint32_t body, const glm::vec3 &force);
+    
+    [[nodiscard]] PhysicsSnapshot snapshot();
+    
+    /**
+     * @brief Rolls the world back (or forward) to the state and tick of snapshot.
+     */
+    void restore(const PhysicsSnapshot &snapshot);
+    
+    void startRecording();
+    PhysicsRecording stopRecording();
+    
+    /**
+     * @brief Restores the start of recording, then runs every tick again with the same inputs.
+     */
+    void replay(const PhysicsRecording &recording);
+    
+    void setFixedTime(double fixedTime) { mFixedTime = fixedTime; }
+    
+    [[nodiscard]] double fixedTime() const { return mFixedTime; }
+    [[nodiscard]] uint64_t ticks() const { return mTicks; }
+    [[nodiscard]] double time() const { return static_cast<double>(mTicks) * mFixedTime; }
+    
+    [[nodiscard]] ecs::Core &ecs() { return mEcs; }
+    [[nodiscard]] CollisionResponse &collisionResponse() { return mCollisionResponse; }
+    [[nodiscard]] TransformHierarchy &hierarchy() { return *mHierarchy; }
+
+protected:
+    ecs::Core           mEcs                { ecs::initFlag::AutoInitialise };
+    CollisionResponse   mCollisionResponse  { mEcs };
+    
+    std::shared_ptr<TransformHierarchy> mHierarchy { std::make_shared<TransformHierarchy>() };
+    
+    std::shared_ptr<octree::Tree<CollisionEntity>> mTree {
+        std::make_shared<octree::Tree<CollisionEntity>>(octree::AABB { glm::vec3(0.f), glm::vec3(52.f) }, 2) };
+    
+    double              mFixedTime          { timers::fixedTime<double>() };
+    uint64_t            mTicks              { 0 };
+    
+    /** Every body in the order it was created, which is also the order they are written to snapshots. */
+    std::vector<SnapshotBody>       mBodies;
+    std::optional<PhysicsRecording> mRecording;
+};
@@ -13,6 +13,7 @@
 #include "BoundingVolumes.h"
 #include "UniformComponents.h"
 #include "Tree.h"
+#include "TransformHierarchy.h"
 
 class CollisionEntity;
 
@@ -21,13 +22,14 @@ class CollisionEntity;
  * @date 06/05/2022
  */
 class TreeBuilder
-    : public ecs::BaseSystem<std::shared_ptr<BoundingVolume>, std::shared_ptr<ModelMatrix>, Velocity>
+    : public ecs::BaseSystem<std::shared_ptr<BoundingVolume>, TransformNode, Velocity>
 {
 public:
-    explicit TreeBuilder(std::shared_ptr<octree::Tree<CollisionEntity>> tree);
+    TreeBuilder(std::shared_ptr<octree::Tree<CollisionEntity>> tree, std::shared_ptr<TransformHierarchy> hierarchy);
     
     void onUpdate() override;
 
 protected:
     std::shared_ptr<octree::Tree<CollisionEntity>> mTree;
+    std::shared_ptr<TransformHierarchy> mHierarchy;
 };
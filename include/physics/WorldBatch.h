@@ -0,0 +1,76 @@
+/**
+ * @file WorldBatch.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "PhysicsWorld.h"
+#include "WorkStealingPool.h"
+
+#include <functional>
+
+/**
+ * @brief The results of every world in a batch stored as columns. Each body has one row in the body columns and each
+ * tick of each world has one row in tickMilliseconds (world major).
+ */
+struct WorldBatchResults
+{
+    std::vector<uint32_t>   world;
+    std::vector<uint32_t>   body;
+    std::vector<float>      positionX;
+    std::vector<float>      positionY;
+    std::vector<float>      positionZ;
+    std::vector<float>      velocityX;
+    std::vector<float>      velocityY;
+    std::vector<float>      velocityZ;
+    
+    uint32_t                ticks { 0 };
+    std::vector<double>     tickMilliseconds;
+};
+
+/**
+ * @brief Owns many isolated physics worlds and steps them across a WorkStealingPool. Each world has its own ecs, tree,
+ * collision response, integrators and fixed time, so no state is shared between them while they are running.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class WorldBatch
+{
+public:
+    /**
+     * @brief Sets up a world and returns the bodies whose final state should be collected.
+     */
+    using Setup = std::function<std::vector<Entity>(PhysicsWorld &world, uint32_t worldIndex)>;
+    
+    /**
+     * @brief Creates and sets up every world on the calling thread, so that any first time registration inside the
+     * ecs is done before the worlds are stepped in parallel.
+     */
+    WorldBatch(uint32_t worldCount, const Setup &setup);
+    
+    /**
+     * @brief Steps every world ticks times. Each world is its own task, so worlds that take longer do not hold up
+     * the others.
+     */
+    void run(uint32_t ticks, WorkStealingPool *pool=&WorkStealingPool::instance());
+    
+    /**
+     * @brief Writes the body columns to statePath and the tick timings to timingPath as csv.
+     */
+    void writeCsv(const std::string &statePath, const std::string &timingPath) const;
+    
+    [[nodiscard]] const WorldBatchResults &results() const { return mResults; }
+    [[nodiscard]] PhysicsWorld &world(uint32_t index) { return *mWorlds[index]; }
+    [[nodiscard]] uint32_t size() const { return static_cast<uint32_t>(mWorlds.size()); }
+
+protected:
+    void collect();
+    
+    std::vector<std::unique_ptr<PhysicsWorld>>  mWorlds;
+    std::vector<std::vector<Entity>>            mBodies;
+    WorldBatchResults                           mResults;
+};
@@ -11,6 +11,8 @@
 #include "Ecs.h"
 #include "Callback.h"
 
+class ConvexHull;
+
 // this, other, position, normal
 typedef Callback<Entity, Entity, glm::vec3&, glm::vec3&> HitCallback;
 
@@ -45,3 +47,13 @@ struct BoundingBox
     
     glm::vec3 halfSize { 1.f };
 };
+
+struct BoundingConvexHull
+    : BoundingVolume
+{
+    BoundingConvexHull(const Entity entity, std::shared_ptr<const ConvexHull> hull) :
+        BoundingVolume(entity), hull(std::move(hull))
+    {}
+    
+    std::shared_ptr<const ConvexHull> hull;
+};
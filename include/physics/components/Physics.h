@@ -9,6 +9,7 @@
 
 #include "Pch.h"
 #include "Callback.h"
+#include "detail/type_quat.hpp"
 
 struct DynamicObject
 {
@@ -37,6 +38,9 @@ struct AngularObject
     glm::mat3 inverseBodyInertia { 1.f };
     glm::vec3 angularMomentum { 0.f };
     glm::mat3 inverseInertia { 1.f };
+    
+    /** The rotation that inverseInertia was last calculated for. It is only recalculated when the body rotates. */
+    glm::quat inertiaRotation { 0.f, 0.f, 0.f, 0.f };
 };
 
 struct Kinematic
@@ -44,6 +48,28 @@ struct Kinematic
     // Only used for testing currently. Has no data assigned to it.
 };
 
+/** A damped spring that pulls the body towards anchor. Evaluated inside each substep by the adaptive integrators. */
+struct Spring
+{
+    glm::vec3   anchor      { 0.f };
+    float       restLength  { 0.f };
+    float       stiffness   { 0.f };
+    float       damping     { 0.f };
+};
+
+/** The error control of a body that is integrated with an adaptive step size. */
+struct AdaptiveStep
+{
+    /** The largest local error (in metres and metres per second) that is accepted for a single substep. */
+    float       tolerance       { 1e-4f };
+    
+    /** The substep size that the next tick will start with. Zero starts with the whole tick. */
+    float       step            { 0.f };
+    
+    uint32_t    acceptedSteps   { 0 };
+    uint32_t    rejectedSteps   { 0 };
+};
+
 struct PhysicsMaterial
 {
     float bounciness { 0.2f };
@@ -13,29 +13,25 @@
 #include "RenderComponents.h"
 #include "UniformComponents.h"
 #include "MaterialComponents.h"
-#include "MainCamera.h"
-#include "Shader.h"
-#include "FilePaths.h"
-#include "FramebufferObject.h"
 #include "Components.h"
+#include "TransformHierarchy.h"
+#include "GeometryBatch.h"
 
 /**
- * A Blinn-Phong Shader the writes to the Geometry buffer rather than the main buffer.
+ * A Blinn-Phong Shader the writes to the Geometry buffer rather than the main buffer. Each mesh is added to a batch
+ * that is drawn by a GeometryBatchRenderer.
  * @author Ryan Purse
  * @date 21/03/2022
  */
 class BlinnPhongGeometryShader
-    : public ecs::BaseSystem<RenderInformation, std::shared_ptr<ModelMatrix>, BlinnPhongMaterial>
+    : public ecs::BaseSystem<RenderInformation, TransformNode, BlinnPhongMaterial>
 {
 public:
-    BlinnPhongGeometryShader(std::shared_ptr<MainCamera> camera, std::shared_ptr<FramebufferObject> framebuffer);
-    
-    void onUpdate() override;
+    BlinnPhongGeometryShader(std::shared_ptr<GeometryBatch> batch, std::shared_ptr<TransformHierarchy> hierarchy);
 
 protected:
-    Shader mShader { path::shaders() + "/blinn-phong/BlinnPhong.vert", path::shaders() + "/blinn-phong/BlinnPhongGeometry.frag" };
-    std::shared_ptr<MainCamera> mCamera;
-    std::shared_ptr<FramebufferObject> mFrameBufferObject;
+    std::shared_ptr<GeometryBatch> mBatch;
+    std::shared_ptr<TransformHierarchy> mHierarchy;
 };
 
 
@@ -0,0 +1,44 @@
+/**
+ * @file CameraUniformBuffer.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "MainCamera.h"
+
+/** Laid out as the std140 Camera block that the shaders declare. */
+struct CameraUniforms
+{
+    glm::mat4   viewProjection  { 1.f };
+    glm::vec3   position        { 0.f };
+    float       padding         { 0.f };
+};
+
+/**
+ * Holds the values of the camera that every shader needs. Uploaded and bound once a frame, so that each shader
+ * reads them from the Camera block instead of having them set one uniform at a time.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class CameraUniformBuffer
+{
+public:
+    /** Must match the binding of the Camera block in the shaders. */
+    static constexpr unsigned int bindingPoint { 0 };
+    
+    CameraUniformBuffer();
+    ~CameraUniformBuffer();
+    
+    /**
+     * @brief Copies the values of camera into the buffer and binds it to bindingPoint.
+     */
+    void update(const MainCamera &camera);
+
+protected:
+    unsigned int    mName       { 0 };
+    CameraUniforms  mUniforms;
+};
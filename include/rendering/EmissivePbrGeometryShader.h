@@ -13,27 +13,23 @@
 #include "RenderComponents.h"
 #include "UniformComponents.h"
 #include "MaterialComponents.h"
-#include "MainCamera.h"
-#include "Shader.h"
-#include "FilePaths.h"
-#include "FramebufferObject.h"
 #include "Components.h"
+#include "TransformHierarchy.h"
+#include "GeometryBatch.h"
 
 /**
- * Writes emissive materials to the geometry buffer.
+ * Writes emissive materials to the geometry buffer. Each mesh is added to a batch that is drawn by a
+ * GeometryBatchRenderer.
  * @author Ryan Purse
  * @date 18/05/2022
  */
 class EmissivePbrGeometryShader
-    : public ecs::BaseSystem<RenderInformation, std::shared_ptr<ModelMatrix>, EmissivePbrMaterial>
+    : public ecs::BaseSystem<RenderInformation, TransformNode, EmissivePbrMaterial>
 {
 public:
-    EmissivePbrGeometryShader(std::shared_ptr<MainCamera> camera, std::shared_ptr<FramebufferObject> output);
-    
-    void onUpdate() override;
+    EmissivePbrGeometryShader(std::shared_ptr<GeometryBatch> batch, std::shared_ptr<TransformHierarchy> hierarchy);
 
 protected:
-    Shader mShader { path::shaders() + "/blinn-phong/BlinnPhong.vert", path::shaders() + "/geometry/EmissiveGeometry.frag" };
-    std::shared_ptr<MainCamera> mCamera;
-    std::shared_ptr<FramebufferObject> mOutput;
+    std::shared_ptr<GeometryBatch> mBatch;
+    std::shared_ptr<TransformHierarchy> mHierarchy;
 };
@@ -0,0 +1,210 @@
+/**
+ * @file GeometryBatch.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "Ecs.h"
+#include "BaseSystem.h"
+#include "RenderComponents.h"
+#include "MainCamera.h"
+#include "Shader.h"
+#include "FramebufferObject.h"
+#include "Components.h"
+#include "HierarchicalDepth.h"
+#include "FilePaths.h"
+#include "BatchIds.h"
+
+#include <array>
+
+/** The per-instance data read by the geometry vertex shader. Matches the std430 Instance in BlinnPhong.vert. */
+struct GeometryInstance
+{
+    glm::mat4 modelMatrix   { 1.f };
+    glm::vec4 colour        { 1.f };
+};
+
+/** One draw of glMultiDrawElementsIndirect. The layout is fixed by OpenGL. */
+struct DrawElementsIndirectCommand
+{
+    uint32_t    count           { 0 };
+    uint32_t    instanceCount   { 0 };
+    uint32_t    firstIndex      { 0 };
+    int         baseVertex      { 0 };
+    uint32_t    baseInstance    { 0 };
+};
+
+/** What the last culling pass did with the instances it was given. */
+struct CullingCounters
+{
+    uint32_t visible            { 0 };
+    uint32_t frustumCulled      { 0 };
+    uint32_t occlusionCulled    { 0 };
+};
+
+/** How many times the last draw changed the bound vao or a texture, and how many it would have without sorting. */
+struct BindCounters
+{
+    uint32_t sorted     { 0 };
+    uint32_t unsorted   { 0 };
+};
+
+/**
+ * Collects every mesh drawn with one geometry shader during a frame and draws them with as few calls as possible.
+ * Entries are radix sorted on a 64-bit key of their textures, vao, mesh and distance from the camera. Each run of the
+ * same mesh becomes one instanced indirect command with its instances front to back, and every command that shares a
+ * vao and textures is submitted with a single glMultiDrawElementsIndirect. Since meshes of a vertex format share a
+ * vao, that is one call for each set of textures, and only the state that changes between calls is bound.
+ * When culling, a compute pass tests the bounding sphere of every instance against the frustum and the hierarchical
+ * depth of the last frame. It packs the survivors into the buffer read by the vertex shader and counts them into the
+ * instance count of their command, so nothing that is culled reaches the vertex shader.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class GeometryBatch
+{
+public:
+    using Textures = std::array<unsigned int, 2>;
+    
+    /**
+     * @param samplerNames - The sampler uniforms that each texture of an entry is bound to, in order.
+     */
+    GeometryBatch(
+        const std::filesystem::path &vertexPath, const std::filesystem::path &fragmentPath,
+        std::vector<std::string> samplerNames);
+    
+    /**
+     * @param materialId - The batch id of textures (e.g., the batchId of a material).
+     */
+    void add(
+        const RenderInformation &renderInformation, const Textures &textures, uint32_t materialId,
+        const GeometryInstance &instance);
+    
+    /**
+     * @brief Draws everything added since the last call to the bound framebuffer, then empties the batch. The view
+     * projection is read from the camera uniform buffer.
+     * @param cameraPosition - Instances of a mesh are drawn nearest to this first.
+     * @param depth - The depth of the last frame to cull against. Only the frustum is tested if it is null.
+     */
+    void draw(const glm::vec3 &cameraPosition, const HierarchicalDepth *depth);
+    
+    void setCulling(bool isCulling);
+    bool isCulling() const;
+    
+    /** The number of draw calls issued by the last draw(). */
+    uint32_t drawCount() const;
+    
+    /** The number of indirect commands submitted by the last draw(), one for each distinct mesh. */
+    uint32_t commandCount() const;
+    
+    /** The number of meshes drawn by the last draw(), which was also the number of draw calls before batching. */
+    uint32_t instanceCount() const;
+    
+    const BindCounters &bindCounters() const;
+    
+    /** The counters of the last culling pass. Read back one draw later so that the gpu is not waited on. */
+    const CullingCounters &cullingCounters() const;
+
+protected:
+    struct Key
+    {
+        unsigned int    vao         { 0 };
+        Textures        textures    { 0, 0 };
+        uint32_t        firstIndex  { 0 };
+        int             baseVertex  { 0 };
+        int             eboCount    { 0 };
+        uint32_t        materialId  { 0 };
+        uint32_t        vaoId       { 0 };
+        uint32_t        meshId      { 0 };
+    };
+    
+    /** A buffer that only grows, so that it is not reallocated every frame. */
+    struct StorageBuffer
+    {
+        StorageBuffer();
+        ~StorageBuffer();
+        
+        /** @brief Makes sure that the buffer is at least bytes large. The contents are lost if it grows. */
+        void reserve(std::size_t bytes);
+        
+        /** @brief Copies bytes of data to the start of the buffer. */
+        void upload(const void *data, std::size_t bytes);
+        
+        unsigned int    name        { 0 };
+        std::size_t     capacity    { 0 };
+    };
+    
+    void cull(const HierarchicalDepth *depth);
+    
+    /**
+     * @returns The sort key of an entry. From most to least significant: its textures, vao, mesh and distance. The
+     * first three are the ids given out when they were made (see BatchIds.h).
+     */
+    static uint64_t sortKey(const Key &key, float distance);
+    
+    /** @returns How many binds drawing the entries in this order would take, if only changes were bound. */
+    uint32_t countBinds(const std::vector<uint32_t> &order) const;
+    
+    Shader                                   mShader;
+    Shader                                   mCull { path::shaders() + "culling/Cull.comp" };
+    std::vector<Shader::Uniform<TextureUnit>> mSamplers;
+    Shader::Uniform<int>                     mCullInstanceCount  { mCull.uniform<int>("u_instance_count") };
+    Shader::Uniform<int>                     mCullUseDepth       { mCull.uniform<int>("u_use_hierarchical_depth") };
+    Shader::Uniform<TextureUnit>             mCullDepth          { mCull.uniform<TextureUnit>("u_hierarchical_depth") };
+    Shader::Uniform<int>                     mCullDepthLevels    { mCull.uniform<int>("u_hierarchical_depth_levels") };
+    bool                                     mIsCulling          { true };
+    
+    std::vector<Key>                         mKeys;
+    std::vector<glm::vec4>                   mBounds;
+    std::vector<GeometryInstance>            mInstances;
+    
+    std::vector<uint64_t>                    mSortKeys;
+    std::vector<uint32_t>                    mOrder;
+    std::vector<uint64_t>                    mSortKeysScratch;
+    std::vector<uint32_t>                    mOrderScratch;
+    std::vector<GeometryInstance>            mSortedInstances;
+    std::vector<uint32_t>                    mInstanceCommands;
+    std::vector<DrawElementsIndirectCommand> mCommands;
+    std::vector<glm::vec4>                   mCommandBounds;
+    
+    StorageBuffer                            mVisibleBuffer;
+    StorageBuffer                            mInstanceBuffer;
+    StorageBuffer                            mInstanceCommandBuffer;
+    StorageBuffer                            mCommandBuffer;
+    StorageBuffer                            mBoundsBuffer;
+    StorageBuffer                            mCounterBuffer;
+    bool                                     mHasCounters        { false };
+    
+    uint32_t                                 mDrawCount          { 0 };
+    uint32_t                                 mCommandCount       { 0 };
+    uint32_t                                 mInstanceCount      { 0 };
+    CullingCounters                          mCullingCounters;
+    BindCounters                             mBindCounters;
+};
+
+/**
+ * Draws a geometry batch once every gathering system of its tag has added to it. Has the same signature as the
+ * gathering systems, so it only runs when there is something to draw.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class GeometryBatchRenderer
+    : public ecs::BaseSystem<RenderInformation, TransformNode>
+{
+public:
+    GeometryBatchRenderer(
+        std::shared_ptr<GeometryBatch> batch, std::shared_ptr<MainCamera> camera,
+        std::shared_ptr<FramebufferObject> framebuffer, std::shared_ptr<HierarchicalDepth> depth);
+    
+    void onUpdate() override;
+
+protected:
+    std::shared_ptr<GeometryBatch> mBatch;
+    std::shared_ptr<MainCamera> mCamera;
+    std::shared_ptr<FramebufferObject> mFrameBufferObject;
+    std::shared_ptr<HierarchicalDepth> mDepth;
+};
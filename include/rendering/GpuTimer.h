@@ -0,0 +1,46 @@
+/**
+ * @file GpuTimer.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+
+#include <array>
+
+/**
+ * Times the gpu work between begin() and end() with time elapsed queries. The results are read a few frames later,
+ * once they are ready, so that the cpu never waits on the gpu for them.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class GpuTimer
+{
+public:
+    GpuTimer();
+    ~GpuTimer();
+    
+    /** @brief Starts timing, unless every query is still waiting for its result. */
+    void begin();
+    
+    /** @brief Stops timing. Does nothing if begin() did not start. */
+    void end();
+    
+    /** @returns The time of the latest query to have finished. */
+    [[nodiscard]] double milliseconds() const;
+
+protected:
+    /** @brief Reads the result of every query that has one ready. */
+    void poll();
+    
+    static constexpr std::size_t queryCount { 4 };
+    
+    std::array<unsigned int, queryCount>    mQueries        { };
+    std::array<bool, queryCount>            mIsPending      { };
+    std::size_t                             mNext           { 0 };
+    bool                                    mIsTiming       { false };
+    double                                  mMilliseconds   { 0.0 };
+};
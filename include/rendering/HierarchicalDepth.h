@@ -0,0 +1,61 @@
+/**
+ * @file HierarchicalDepth.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "FramebufferObject.h"
+#include "MipmapTexture.h"
+#include "Shader.h"
+#include "FilePaths.h"
+
+/**
+ * A mip chain of the depth buffer where every texel holds the farthest depth of the texels it covers in the level
+ * above. Built from the depth of the geometry buffer at the end of each frame, so that the next frame can tell when a
+ * whole bounding sphere is behind what has already been drawn.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class HierarchicalDepth
+{
+public:
+    explicit HierarchicalDepth(const glm::ivec2 &size);
+    ~HierarchicalDepth();
+    
+    /**
+     * @brief Copies the depth buffer of source and rebuilds every level from it. Source must be the same size.
+     */
+    void build(const FramebufferObject &source);
+    
+    /** @returns False until the first build(), as there is no depth to test against before then. */
+    [[nodiscard]] bool isValid() const;
+    [[nodiscard]] unsigned int getName() const;
+    [[nodiscard]] int getLevels() const;
+    [[nodiscard]] const glm::ivec2 &getSize() const;
+
+protected:
+    /**
+     * @brief Writes the farthest depth of the texels of input under each texel of outputLevel of the pyramid.
+     */
+    void reduce(
+        unsigned int input, int inputLevel, const glm::ivec2 &inputSize, int outputLevel, const glm::ivec2 &outputSize);
+    
+    glm::ivec2      mSize;
+    int             mLevels         { 1 };
+    bool            mIsValid        { false };
+    
+    /** The depth renderbuffer cannot be sampled, so it is blitted into this texture first. */
+    unsigned int    mDepthTexture   { 0 };
+    unsigned int    mDepthFbo       { 0 };
+    
+    std::unique_ptr<MipmapTexture> mPyramid;
+    Shader mReduce { path::shaders() + "culling/HierarchicalDepth.comp" };
+    Shader::Uniform<TextureUnit> mInput         { mReduce.uniform<TextureUnit>("u_input") };
+    Shader::Uniform<int>         mInputLevel    { mReduce.uniform<int>("u_input_level") };
+    Shader::Uniform<glm::vec2>   mInputSize     { mReduce.uniform<glm::vec2>("u_input_size") };
+    Shader::Uniform<glm::vec2>   mOutputSize    { mReduce.uniform<glm::vec2>("u_output_size") };
+};
@@ -0,0 +1,128 @@
+/**
+ * @file ClusteredLighting.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "Shader.h"
+#include "FilePaths.h"
+#include "FramebufferObject.h"
+#include "TextureBufferObject.h"
+#include "MainCamera.h"
+#include "Mesh.h"
+#include "MaterialComponents.h"
+#include "Primitives.h"
+#include "LightingComponents.h"
+
+/** A point light as the clustered lighting shaders read it. Matches the std430 PointLight in Clusters.comp. */
+struct ClusterLight
+{
+    glm::vec3   position        { 0.f };
+    float       distance        { 10.f };
+    glm::vec3   intensity       { 1.f };
+    float       power           { 1.f };
+    glm::vec3   viewPosition    { 0.f };
+    float       padding         { 0.f };
+};
+
+/**
+ * Lights the geometry buffer with every point light in one full screen pass. A compute pass first sorts the lights
+ * into a grid of clusters that split the view frustum across the screen and exponentially in depth, so that each
+ * pixel reads the geometry buffer once and only loops over the lights of its own cluster.
+ * The point light shader decides the path each frame. When this is enabled, it adds its lights here instead of
+ * drawing a volume for each of them.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class ClusteredLighting
+{
+public:
+    // Must match the defines of Clusters.comp and ClusteredLighting.frag.
+    static constexpr int gridX                  { 16 };
+    static constexpr int gridY                  { 9 };
+    static constexpr int gridZ                  { 24 };
+    static constexpr int maxLightsPerCluster    { 256 };
+    
+    /** Where the depth slices start. Anything nearer is in the first slice. */
+    static constexpr float nearSlice            { 0.1f };
+    
+    ClusteredLighting(
+        std::shared_ptr<MainCamera> camera,
+        std::shared_ptr<FramebufferObject> lightAccumulationBuffer,
+        std::shared_ptr<TextureBufferObject> positions,
+        std::shared_ptr<TextureBufferObject> normals,
+        std::shared_ptr<TextureBufferObject> albedo);
+    
+    ~ClusteredLighting();
+    
+    void setEnabled(bool isEnabled);
+    [[nodiscard]] bool isEnabled() const;
+    
+    void add(const glm::vec3 &position, const light::PointLight &pointLight);
+    
+    /** @brief Lights the light accumulation buffer with everything added this frame, if enabled. */
+    void render();
+    
+    /**
+     * @brief Sorts everything added this frame into the clusters without lighting anything, for passes that do
+     * their own lighting. The lights, counts and indices are left bound to storage buffers 0, 1 and 2.
+     */
+    void cluster();
+    
+    /** @returns The number of lights sorted by the last render() or cluster(). */
+    [[nodiscard]] uint32_t lightCount() const;
+    
+    /**
+     * @returns How many times a light was left out of a cluster because it already had maxLightsPerCluster. Read
+     * a frame late so that it never stalls on the gpu. Anything but 0 means that some pixels are missing lights.
+     */
+    [[nodiscard]] uint32_t droppedLights() const;
+    
+    /** @returns How many clusters had more than maxLightsPerCluster lights. Read a frame late, like droppedLights(). */
+    [[nodiscard]] uint32_t fullClusters() const;
+
+protected:
+    /** Matches ClusterOverflow in Clusters.comp. */
+    struct Overflow
+    {
+        uint32_t droppedLights  { 0 };
+        uint32_t fullClusters   { 0 };
+    };
+    
+    bool mIsEnabled { false };
+    
+    Shader mCluster { path::shaders() + "lighting/Clusters.comp" };
+    Shader::Uniform<glm::mat4>   mInverseProjection { mCluster.uniform<glm::mat4>("u_inverse_projection") };
+    Shader::Uniform<int>         mClusterLightCount { mCluster.uniform<int>("u_light_count") };
+    Shader::Uniform<float>       mClusterNear       { mCluster.uniform<float>("u_near") };
+    Shader::Uniform<float>       mClusterFar        { mCluster.uniform<float>("u_far") };
+    
+    Shader mShader { path::shaders() + "ScreenOverlay.vert", path::shaders() + "lighting/ClusteredLighting.frag" };
+    Shader::Uniform<glm::mat4>   mMvpMatrix         { mShader.uniform<glm::mat4>("u_mvp_matrix") };
+    Shader::Uniform<glm::mat4>   mView              { mShader.uniform<glm::mat4>("u_view") };
+    Shader::Uniform<float>       mNear              { mShader.uniform<float>("u_near") };
+    Shader::Uniform<float>       mFar               { mShader.uniform<float>("u_far") };
+    Shader::Uniform<TextureUnit> mPositionsUnit     { mShader.uniform<TextureUnit>("u_positions") };
+    Shader::Uniform<TextureUnit> mNormalsUnit       { mShader.uniform<TextureUnit>("u_normals") };
+    Shader::Uniform<TextureUnit> mAlbedoUnit        { mShader.uniform<TextureUnit>("u_albedo") };
+    
+    Mesh<UvVertex, NoMaterial> mQuad { primitives::plane<UvVertex>()[0] };
+    
+    std::shared_ptr<MainCamera>          mCamera;
+    std::shared_ptr<FramebufferObject>   mLightAccumulationBuffer;
+    std::shared_ptr<TextureBufferObject> mPositions;
+    std::shared_ptr<TextureBufferObject> mNormals;
+    std::shared_ptr<TextureBufferObject> mAlbedo;
+    
+    std::vector<ClusterLight>   mLights;
+    unsigned int                mLightBuffer        { 0 };
+    unsigned int                mCountBuffer        { 0 };
+    unsigned int                mIndexBuffer        { 0 };
+    unsigned int                mOverflowBuffer     { 0 };
+    uint32_t                    mLightCount         { 0 };
+    Overflow                    mOverflow;
+};
@@ -12,6 +12,9 @@
 #include "FilePaths.h"
 #include "TextureBufferObject.h"
 #include "MainCamera.h"
+#include "Mesh.h"
+#include "MaterialComponents.h"
+#include "Primitives.h"
 
 class FramebufferObject;
 
@@ -29,14 +32,18 @@ public:
         std::shared_ptr<TextureBufferObject> specular, std::shared_ptr<TextureBufferObject> albedo,
         std::shared_ptr<TextureBufferObject> emissive);
     
+    ~DeferredLightShader();
+    
     void render();
     
 protected:
     Shader mShader { path::shaders() + "ScreenOverlay.vert", path::resources() + "shaders/lighting/Output.frag" };
-    unsigned int mVao { 0 };
-    unsigned int mEbo { 0 };
-    unsigned int mVbo { 0 };
-    int          mEboCount { 0 };
+    Shader::Uniform<TextureUnit> mDiffuseUnit  { mShader.uniform<TextureUnit>("u_diffuse") };
+    Shader::Uniform<TextureUnit> mSpecularUnit { mShader.uniform<TextureUnit>("u_specular") };
+    Shader::Uniform<TextureUnit> mAlbedoUnit   { mShader.uniform<TextureUnit>("u_albedo") };
+    Shader::Uniform<TextureUnit> mEmissiveUnit { mShader.uniform<TextureUnit>("u_emissive") };
+    Shader::Uniform<glm::mat4>   mMvpMatrix    { mShader.uniform<glm::mat4>("u_mvp_matrix") };
+    Mesh<UvVertex, NoMaterial> mQuad { primitives::plane<UvVertex>()[0] };
     
     std::shared_ptr<MainCamera>          mCamera;
     std::shared_ptr<FramebufferObject>   mOutput;
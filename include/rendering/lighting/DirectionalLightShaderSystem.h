@@ -11,13 +11,12 @@
 #include "Ecs.h"
 #include "BaseSystem.h"
 #include "LightingComponents.h"
-#include "Shader.h"
-#include "FramebufferObject.h"
-#include "FilePaths.h"
-#include "MainCamera.h"
+#include "DirectionalLighting.h"
+#include "FusedLighting.h"
 
 /**
- * Handles the rendering of directional lights to a framebuffer.
+ * Hands the directional lights within the scene over to be drawn with the rest of the lighting, either by the fused
+ * lighting when it is enabled or by a pass of their own.
  * @author Ryan Purse
  * @date 23/03/2022
  */
@@ -26,37 +25,10 @@ class DirectionalLightShaderSystem
 {
 public:
     DirectionalLightShaderSystem(
-        std::shared_ptr<MainCamera> camera,
-        std::shared_ptr<FramebufferObject> lightAccumulationBuffer,
-        std::shared_ptr<TextureBufferObject> positions,
-        std::shared_ptr<TextureBufferObject> normals,
-        std::shared_ptr<TextureBufferObject> albedo);
-    
-    ~DirectionalLightShaderSystem();
-    
-    void onUpdate() override;
+        std::shared_ptr<DirectionalLighting> directionalLighting,
+        std::shared_ptr<FusedLighting> fusedLighting);
 
 protected:
-    void bind();
-    
-    Shader mShader {
-        path::shaders() + "/ScreenOverlay.vert",
-        path::shaders() + "/lighting/DirectionalLighting.frag"
-    };
-    
-    
-    unsigned int    mVao        { 0 };
-    unsigned int    mEbo        { 0 };
-    unsigned int    mVbo        { 0 };
-    int             mEboCount   { 0 };
-    
-    std::shared_ptr<MainCamera>          mCamera;
-    std::shared_ptr<FramebufferObject>   mLightAccumulationBuffer;
-    
-    // Todo: this needs to be converted into a struct of Texture buffers called the geometry buffer.
-    std::shared_ptr<TextureBufferObject> mPositions;
-    std::shared_ptr<TextureBufferObject> mNormals;
-    std::shared_ptr<TextureBufferObject> mAlbedo;
+    std::shared_ptr<DirectionalLighting> mDirectionalLighting;
+    std::shared_ptr<FusedLighting>       mFusedLighting;
 };
-
-
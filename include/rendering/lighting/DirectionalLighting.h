@@ -0,0 +1,63 @@
+/**
+ * @file DirectionalLighting.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "Shader.h"
+#include "FilePaths.h"
+#include "FramebufferObject.h"
+#include "TextureBufferObject.h"
+#include "Mesh.h"
+#include "MaterialComponents.h"
+#include "Primitives.h"
+#include "LightingComponents.h"
+
+/**
+ * Lights the geometry buffer with a full screen pass for each directional light. The directional light shader adds
+ * its lights here, so that they are drawn with the rest of the lighting once the renderer has finished the geometry.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class DirectionalLighting
+{
+public:
+    DirectionalLighting(
+        std::shared_ptr<FramebufferObject> lightAccumulationBuffer,
+        std::shared_ptr<TextureBufferObject> positions,
+        std::shared_ptr<TextureBufferObject> normals,
+        std::shared_ptr<TextureBufferObject> albedo);
+    
+    ~DirectionalLighting();
+    
+    void add(const light::DirectionalLight &directionalLight);
+    
+    /** @brief Lights the light accumulation buffer with everything added this frame. */
+    void render();
+
+protected:
+    Shader mShader {
+        path::shaders() + "/ScreenOverlay.vert",
+        path::shaders() + "/lighting/DirectionalLighting.frag"
+    };
+    
+    Shader::Uniform<glm::vec3>   mLightDirection { mShader.uniform<glm::vec3>("u_light_direction") };
+    Shader::Uniform<glm::vec3>   mLightIntensity { mShader.uniform<glm::vec3>("u_light_intensity") };
+    Shader::Uniform<TextureUnit> mPositionsUnit  { mShader.uniform<TextureUnit>("u_positions") };
+    Shader::Uniform<TextureUnit> mNormalsUnit    { mShader.uniform<TextureUnit>("u_normals") };
+    Shader::Uniform<TextureUnit> mAlbedoUnit     { mShader.uniform<TextureUnit>("u_albedo") };
+    Shader::Uniform<glm::mat4>   mMvpMatrix      { mShader.uniform<glm::mat4>("u_mvp_matrix") };
+    
+    Mesh<UvVertex, NoMaterial> mQuad { primitives::plane<UvVertex>()[0] };
+    
+    std::shared_ptr<FramebufferObject>   mLightAccumulationBuffer;
+    std::shared_ptr<TextureBufferObject> mPositions;
+    std::shared_ptr<TextureBufferObject> mNormals;
+    std::shared_ptr<TextureBufferObject> mAlbedo;
+    
+    std::vector<light::DirectionalLight> mLights;
+};
@@ -0,0 +1,92 @@
+/**
+ * @file FusedLighting.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "Shader.h"
+#include "FilePaths.h"
+#include "TextureBufferObject.h"
+#include "MainCamera.h"
+#include "LightingComponents.h"
+#include "ClusteredLighting.h"
+
+/** A directional light as FusedLighting.comp reads it. Matches the std430 DirectionalLight there. */
+struct FusedDirectionalLight
+{
+    glm::vec3   direction           { 0.f };
+    float       directionPadding    { 0.f };
+    glm::vec3   intensity           { 1.f };
+    float       intensityPadding    { 0.f };
+};
+
+/**
+ * Lights the whole scene in a single compute pass. Each pixel reads the geometry buffer once, adds up every
+ * directional light and the point lights of its cluster, and writes the final colour straight into the light target.
+ * This skips the diffuse and specular buffers, and the composite that reads them back, entirely.
+ * Point lights are sorted by the clustered lighting, which must be enabled for the point light shader to hand them
+ * over. The directional light shader hands its lights over here instead of drawing them when this is enabled.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class FusedLighting
+{
+public:
+    FusedLighting(
+        std::shared_ptr<MainCamera> camera,
+        std::shared_ptr<ClusteredLighting> clusteredLighting,
+        std::shared_ptr<TextureBufferObject> lightTarget,
+        std::shared_ptr<TextureBufferObject> positions,
+        std::shared_ptr<TextureBufferObject> normals,
+        std::shared_ptr<TextureBufferObject> albedo,
+        std::shared_ptr<TextureBufferObject> emissive);
+    
+    ~FusedLighting();
+    
+    void setEnabled(bool isEnabled);
+    [[nodiscard]] bool isEnabled() const;
+    
+    void add(const light::DirectionalLight &directionalLight);
+    
+    /** @brief Writes the lit colour of every pixel into the light target. The light target must be RGBA16F. */
+    void render();
+    
+    /**
+     * @returns How many bytes the last render() did not read or write compared to the separate passes. Counts the
+     * clear of the diffuse and specular buffers, a geometry buffer read and blend for each directional light and the
+     * clustered point lights, and reading diffuse and specular in the composite. Light volumes cost more than this.
+     */
+    [[nodiscard]] uint64_t savedBytes() const;
+
+protected:
+    bool mIsEnabled { false };
+    
+    Shader mShader { path::shaders() + "lighting/FusedLighting.comp" };
+    Shader::Uniform<TextureUnit> mPositionsUnit         { mShader.uniform<TextureUnit>("u_positions") };
+    Shader::Uniform<TextureUnit> mNormalsUnit           { mShader.uniform<TextureUnit>("u_normals") };
+    Shader::Uniform<TextureUnit> mAlbedoUnit            { mShader.uniform<TextureUnit>("u_albedo") };
+    Shader::Uniform<TextureUnit> mEmissiveUnit          { mShader.uniform<TextureUnit>("u_emissive") };
+    Shader::Uniform<glm::mat4>   mView                  { mShader.uniform<glm::mat4>("u_view") };
+    Shader::Uniform<float>       mNear                  { mShader.uniform<float>("u_near") };
+    Shader::Uniform<float>       mFar                   { mShader.uniform<float>("u_far") };
+    Shader::Uniform<int>         mPointLightCount       { mShader.uniform<int>("u_point_light_count") };
+    Shader::Uniform<int>         mDirectionalLightCount { mShader.uniform<int>("u_directional_light_count") };
+    
+    std::shared_ptr<MainCamera>          mCamera;
+    std::shared_ptr<ClusteredLighting>   mClusteredLighting;
+    std::shared_ptr<TextureBufferObject> mLightTarget;
+    std::shared_ptr<TextureBufferObject> mPositions;
+    std::shared_ptr<TextureBufferObject> mNormals;
+    std::shared_ptr<TextureBufferObject> mAlbedo;
+    std::shared_ptr<TextureBufferObject> mEmissive;
+    
+    std::vector<FusedDirectionalLight>  mDirectionalLights;
+    unsigned int                        mDirectionalLightBuffer { 0 };
+    
+    /** The number of full screen lighting passes that the last render() replaced. */
+    uint32_t                            mPassesReplaced         { 0 };
+};
@@ -0,0 +1,82 @@
+/**
+ * @file InstancedLightVolumes.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "Shader.h"
+#include "FilePaths.h"
+#include "FramebufferObject.h"
+#include "TextureBufferObject.h"
+#include "Mesh.h"
+#include "MaterialComponents.h"
+#include "ModelLoader.h"
+#include "LightingComponents.h"
+
+/** A point light as PointLightVolume.vert reads it. Matches the std430 PointLight there. */
+struct VolumeLight
+{
+    glm::vec3   position        { 0.f };
+    float       distance        { 10.f };
+    glm::vec3   intensity       { 1.f };
+    float       power           { 1.f };
+};
+
+/**
+ * Lights the geometry buffer by drawing the volume of every point light in one instanced draw, with each instance
+ * reading its light from a storage buffer. Only the far side of each volume is drawn, and only where it is behind
+ * the depth of the geometry buffer, so pixels in front of or past a volume are never shaded by it.
+ * The point light shader adds its lights here instead of drawing them itself when this is enabled.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class InstancedLightVolumes
+{
+public:
+    InstancedLightVolumes(
+        std::shared_ptr<FramebufferObject> lightAccumulationBuffer,
+        std::shared_ptr<FramebufferObject> geometryBuffer,
+        std::shared_ptr<TextureBufferObject> positions,
+        std::shared_ptr<TextureBufferObject> normals,
+        std::shared_ptr<TextureBufferObject> albedo);
+    
+    ~InstancedLightVolumes();
+    
+    void setEnabled(bool isEnabled);
+    [[nodiscard]] bool isEnabled() const;
+    
+    void add(const glm::vec3 &position, const light::PointLight &pointLight);
+    
+    /** @brief Lights the light accumulation buffer with everything added this frame, if enabled. */
+    void render();
+    
+    /** @returns The number of lights drawn by the last render(). */
+    [[nodiscard]] uint32_t lightCount() const;
+
+protected:
+    bool mIsEnabled { false };
+    
+    Shader mShader {
+        path::shaders() + "lighting/PointLightVolume.vert",
+        path::shaders() + "lighting/InstancedPointLighting.frag"
+    };
+    Shader::Uniform<TextureUnit> mPositionsUnit  { mShader.uniform<TextureUnit>("u_positions") };
+    Shader::Uniform<TextureUnit> mNormalsUnit    { mShader.uniform<TextureUnit>("u_normals") };
+    Shader::Uniform<TextureUnit> mAlbedoUnit     { mShader.uniform<TextureUnit>("u_albedo") };
+    
+    Mesh<UvVertex, NoMaterial> mVolume { load::model<UvVertex, NoMaterial>(path::resources() + "models/lighting/PointLightVolume.obj")[0] };
+    
+    std::shared_ptr<FramebufferObject>   mLightAccumulationBuffer;
+    std::shared_ptr<FramebufferObject>   mGeometryBuffer;
+    std::shared_ptr<TextureBufferObject> mPositions;
+    std::shared_ptr<TextureBufferObject> mNormals;
+    std::shared_ptr<TextureBufferObject> mAlbedo;
+    
+    std::vector<VolumeLight>    mLights;
+    unsigned int                mLightBuffer    { 0 };
+    uint32_t                    mLightCount     { 0 };
+};
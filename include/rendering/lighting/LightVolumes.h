@@ -0,0 +1,75 @@
+/**
+ * @file LightVolumes.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "Shader.h"
+#include "FilePaths.h"
+#include "FramebufferObject.h"
+#include "TextureBufferObject.h"
+#include "MainCamera.h"
+#include "Mesh.h"
+#include "MaterialComponents.h"
+#include "ModelLoader.h"
+#include "LightingComponents.h"
+
+/**
+ * Lights the geometry buffer by drawing the volume of each point light on its own. This is the path that the point
+ * light shader takes when neither clustered lighting nor instanced light volumes are enabled. The lights are added
+ * here, so that they are drawn with the rest of the lighting once the renderer has finished the geometry.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class LightVolumes
+{
+public:
+    LightVolumes(
+        std::shared_ptr<MainCamera> camera,
+        std::shared_ptr<FramebufferObject> lightAccumulationBuffer,
+        std::shared_ptr<TextureBufferObject> positions,
+        std::shared_ptr<TextureBufferObject> normals,
+        std::shared_ptr<TextureBufferObject> albedo);
+    
+    ~LightVolumes();
+    
+    void add(const glm::vec3 &position, const light::PointLight &pointLight);
+    
+    /** @brief Lights the light accumulation buffer with everything added this frame. */
+    void render();
+
+protected:
+    struct Light
+    {
+        glm::vec3           position;
+        light::PointLight   pointLight;
+    };
+    
+    Shader mShader {
+        path::shaders() + "/ScreenOverlay.vert",
+        path::shaders() + "/lighting/PointLighting.frag"
+    };
+    
+    Shader::Uniform<glm::mat4>   mMvpMatrix      { mShader.uniform<glm::mat4>("u_mvp_matrix") };
+    Shader::Uniform<glm::vec3>   mLightPosition  { mShader.uniform<glm::vec3>("u_light_position") };
+    Shader::Uniform<glm::vec3>   mLightIntensity { mShader.uniform<glm::vec3>("u_light_intensity") };
+    Shader::Uniform<float>       mLightDistance  { mShader.uniform<float>("u_light_distance") };
+    Shader::Uniform<float>       mLightPower     { mShader.uniform<float>("u_light_power") };
+    Shader::Uniform<TextureUnit> mPositionsUnit  { mShader.uniform<TextureUnit>("u_positions") };
+    Shader::Uniform<TextureUnit> mNormalsUnit    { mShader.uniform<TextureUnit>("u_normals") };
+    Shader::Uniform<TextureUnit> mAlbedoUnit     { mShader.uniform<TextureUnit>("u_albedo") };
+    
+    Mesh<UvVertex, NoMaterial> mVolume { load::model<UvVertex, NoMaterial>(path::resources() + "models/lighting/PointLightVolume.obj")[0] };
+    
+    std::shared_ptr<MainCamera>          mCamera;
+    std::shared_ptr<FramebufferObject>   mLightAccumulationBuffer;
+    std::shared_ptr<TextureBufferObject> mPositions;
+    std::shared_ptr<TextureBufferObject> mNormals;
+    std::shared_ptr<TextureBufferObject> mAlbedo;
+    
+    std::vector<Light> mLights;
+};
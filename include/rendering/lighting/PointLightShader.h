@@ -11,14 +11,14 @@
 #include "Ecs.h"
 #include "BaseSystem.h"
 #include "LightingComponents.h"
-#include "Shader.h"
-#include "FramebufferObject.h"
-#include "FilePaths.h"
-#include "MainCamera.h"
 #include "Components.h"
+#include "LightVolumes.h"
+#include "ClusteredLighting.h"
+#include "InstancedLightVolumes.h"
 
 /**
- * Renders all of the point lights within the scene.
+ * Hands the point lights within the scene over to be drawn with the rest of the lighting. Clustered lighting or
+ * instanced light volumes take them when enabled, otherwise each light draws its own volume.
  * @author Ryan Purse
  * @date 31/03/2022
  */
@@ -27,34 +27,12 @@ class PointLightShader
 {
 public:
     PointLightShader(
-        std::shared_ptr<MainCamera> camera,
-        std::shared_ptr<FramebufferObject> lightAccumulationBuffer,
-        std::shared_ptr<TextureBufferObject> positions,
-        std::shared_ptr<TextureBufferObject> normals,
-        std::shared_ptr<TextureBufferObject> albedo);
-    
-    ~PointLightShader();
-    
-    void onUpdate() override;
+        std::shared_ptr<LightVolumes> lightVolumes,
+        std::shared_ptr<ClusteredLighting> clusteredLighting,
+        std::shared_ptr<InstancedLightVolumes> instancedLightVolumes);
+
 protected:
-    void bind();
-    
-    Shader mShader {
-        path::shaders() + "/ScreenOverlay.vert",
-        path::shaders() + "/lighting/PointLighting.frag"
-    };
-    
-    unsigned int    mVao        { 0 };
-    unsigned int    mEbo        { 0 };
-    unsigned int    mVbo        { 0 };
-    int             mEboCount   { 0 };
-    
-    std::shared_ptr<MainCamera>          mCamera;
-    std::shared_ptr<FramebufferObject>   mLightAccumulationBuffer;
-    
-    std::shared_ptr<TextureBufferObject> mPositions;
-    std::shared_ptr<TextureBufferObject> mNormals;
-    std::shared_ptr<TextureBufferObject> mAlbedo;
+    std::shared_ptr<LightVolumes>           mLightVolumes;
+    std::shared_ptr<ClusteredLighting>      mClusteredLighting;
+    std::shared_ptr<InstancedLightVolumes>  mInstancedLightVolumes;
 };
-
-
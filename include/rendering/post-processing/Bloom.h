@@ -12,6 +12,9 @@
 #include "FramebufferObject.h"
 #include "TextureBufferObject.h"
 #include "FilePaths.h"
+#include "Mesh.h"
+#include "MaterialComponents.h"
+#include "Primitives.h"
 
 
 /**
@@ -42,12 +45,31 @@ protected:
     Shader mUpSample   { path::shaders() + "ScreenOverlay.vert", path::shaders() + "post-processing/BloomUpSample.frag"  };
     Shader mComposite  { path::shaders() + "ScreenOverlay.vert", path::shaders() + "post-processing/BloomComposite.frag" };
     
+    Shader::Uniform<glm::mat4>   mPreFilterMvp          { mPreFilter.uniform<glm::mat4>("u_mvp_matrix") };
+    Shader::Uniform<glm::vec3>   mPreFilterThreshold    { mPreFilter.uniform<glm::vec3>("u_light_key_threshold") };
+    Shader::Uniform<TextureUnit> mPreFilterTexture      { mPreFilter.uniform<TextureUnit>("u_texture") };
+    
+    Shader::Uniform<glm::mat4>   mDownSampleMvp         { mDownSample.uniform<glm::mat4>("u_mvp_matrix") };
+    Shader::Uniform<int>         mDownSampleMipLevel    { mDownSample.uniform<int>("u_mip_level") };
+    Shader::Uniform<glm::vec2>   mDownSampleMipSize     { mDownSample.uniform<glm::vec2>("u_mip_size") };
+    Shader::Uniform<TextureUnit> mDownSampleTexture     { mDownSample.uniform<TextureUnit>("u_texture") };
+    
+    Shader::Uniform<glm::mat4>   mUpSampleMvp           { mUpSample.uniform<glm::mat4>("u_mvp_matrix") };
+    Shader::Uniform<int>         mUpSampleUpMipLevel    { mUpSample.uniform<int>("u_up_mip_level") };
+    Shader::Uniform<int>         mUpSampleDownMipLevel  { mUpSample.uniform<int>("u_down_mip_level") };
+    Shader::Uniform<glm::vec2>   mUpSampleMipSize       { mUpSample.uniform<glm::vec2>("u_mip_size") };
+    Shader::Uniform<float>       mUpSampleScale         { mUpSample.uniform<float>("u_scale") };
+    Shader::Uniform<TextureUnit> mUpSampleUpTexture     { mUpSample.uniform<TextureUnit>("u_up_sample_texture") };
+    Shader::Uniform<TextureUnit> mUpSampleDownTexture   { mUpSample.uniform<TextureUnit>("u_down_sample_texture") };
+    
+    Shader::Uniform<glm::mat4>   mCompositeMvp          { mComposite.uniform<glm::mat4>("u_mvp_matrix") };
+    Shader::Uniform<TextureUnit> mCompositeOriginal     { mComposite.uniform<TextureUnit>("u_original") };
+    Shader::Uniform<TextureUnit> mCompositeBloom        { mComposite.uniform<TextureUnit>("u_bloom") };
+    Shader::Uniform<float>       mCompositeExposure     { mComposite.uniform<float>("u_exposure") };
+    
     glm::vec3 mBloomThreshold { 1.f };
     float mBloomScale { 1.f };
     float mExposure { 1.f };
     
-    unsigned int mVao { 0 };
-    unsigned int mEbo { 0 };
-    unsigned int mVbo { 0 };
-    int mEboCount { 0 };
+    Mesh<UvVertex, NoMaterial> mQuad { primitives::plane<UvVertex>()[0] };
 };
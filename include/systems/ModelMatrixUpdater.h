@@ -11,17 +11,61 @@
 #include "Ecs.h"
 #include "Components.h"
 #include "UniformComponents.h"
+#include "TransformSnapshots.h"
+#include "TransformHierarchy.h"
+#include "WorkStealingPool.h"
 
 /**
- * Updates the Basic uniforms by the transform of an object.
+ * Updates the Basic uniforms by the transform of an object. When given snapshots, the transform is interpolated
+ * between the last two fixed ticks instead. Only sets the local transforms of the hierarchy, so a
+ * TransformHierarchyUpdater must be created after it to build the matrices.
  * @author Ryan Purse
  * @date 14/02/2022
  */
 class ModelMatrixUpdater
-    : public ecs::BaseSystem<std::shared_ptr<ModelMatrix>, Transform>
+    : public ecs::BaseSystem<TransformNode, Position, Rotation, Scale>
 {
 public:
-    ModelMatrixUpdater();
+    explicit ModelMatrixUpdater(
+        std::shared_ptr<TransformHierarchy> hierarchy, std::shared_ptr<TransformSnapshots> snapshots=nullptr);
+    
+    /**
+     * @brief Sets the local transform of a single node, interpolated from snapshots if given. Nodes that are not in
+     * the snapshots yet are left as they are. Static nodes are skipped.
+     */
+    static void update(
+        const TransformSnapshots *snapshots, TransformHierarchy &hierarchy, TransformNode node,
+        const Position &position, const Rotation &rotation, const Scale &scale);
+
+protected:
+    std::shared_ptr<TransformHierarchy> mHierarchy;
+    std::shared_ptr<TransformSnapshots> mSnapshots;
 };
 
 
+
+/**
+ * @brief Creates the parallel version of ModelMatrixUpdater, which sets the local transforms in chunks of grainSize,
+ * followed by the TransformHierarchyUpdater that builds the matrices.
+ */
+void createParallelModelMatrixUpdater(
+    ecs::Core &ecs, std::shared_ptr<TransformHierarchy> hierarchy, std::shared_ptr<TransformSnapshots> snapshots=nullptr,
+    uint32_t grainSize=1024, WorkStealingPool *pool=&WorkStealingPool::instance());
+
+struct ModelMatrixBenchmark
+{
+    uint32_t    entityCount { 0 };
+    double      serialMs    { 0.0 };
+    
+    /** The time of a serial update when no transform has changed since the last one. */
+    double      unchangedMs { 0.0 };
+    
+    /** The time of one update for each number of workers (the calling thread also helps). */
+    std::vector<std::pair<uint32_t, double>> parallelMs;
+};
+
+/**
+ * @brief Times ModelMatrixUpdater against the parallel version on pools of 1, 2, 4... workers up to the number of
+ * cores. Every transform is moved before each timed update so that every matrix has to be rebuilt.
+ */
+ModelMatrixBenchmark benchmarkModelMatrixUpdater(uint32_t entityCount, uint32_t steps=10);
@@ -0,0 +1,146 @@
+/**
+ * @file ModelSpawner.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "Ecs.h"
+#include "Components.h"
+#include "RenderComponents.h"
+#include "Mesh.h"
+#include "TransformHierarchy.h"
+
+/**
+ * @brief The components of every mesh slot of a model, copied out once so that any number of instances can be spawned
+ * from them.
+ */
+template<typename TMaterial>
+struct ModelPrefab
+{
+    /** The tag that the render information is added with, which decides the shader that draws it. */
+    Component                       tag { 0 };
+    std::vector<RenderInformation>  renderInformation;
+    std::vector<TMaterial>          materials;
+};
+
+namespace spawn
+{
+    template<typename TVertex, typename TMaterial>
+    ModelPrefab<TMaterial> prefab(const Model<TVertex, TMaterial> &meshes, const Component tag)
+    {
+        ModelPrefab<TMaterial> result { tag };
+        result.renderInformation.reserve(meshes.size());
+        result.materials.reserve(meshes.size());
+        for (const auto &mesh : meshes)
+        {
+            result.renderInformation.emplace_back(mesh.renderInformation);
+            result.materials.emplace_back(mesh.material);
+        }
+        return result;
+    }
+    
+    /**
+     * @brief Creates a parent entity with a transform, a model entity and one entity for each mesh slot of the prefab.
+     * Every slot shares the node of the parent, so the whole model is drawn with one world matrix.
+     * @returns The parent entity.
+     */
+    template<typename TMaterial>
+    Entity model(ecs::Core &ecs, TransformHierarchy &hierarchy, const ModelPrefab<TMaterial> &prefab, const Transform &transform)
+    {
+        const TransformNode node = hierarchy.create(transform);
+        
+        Entity parent    = ecs.create();
+        Entity model     = ecs.create();  // Just contains model slots for hierarchical purity.
+        
+        // The parent only needs a position, rotation, scale, its node and a model child entity.
+        ecs.add(parent, model);
+        ecs.add(parent, Position { transform.position });
+        ecs.add(parent, Rotation { transform.rotation });
+        ecs.add(parent, Scale { transform.scale });
+        ecs.add(parent, node);
+        
+        for (std::size_t i = 0; i < prefab.renderInformation.size(); ++i)
+        {
+            Entity modelSlot = ecs.create();
+            ecs.add(model, modelSlot);
+            
+            ecs.add(modelSlot, prefab.tag, prefab.renderInformation[i]);
+            ecs.add(modelSlot, prefab.materials[i]);
+            ecs.add(modelSlot, node);
+        }
+        
+        return parent;
+    }
+    
+    /**
+     * @brief Creates one instance of prefab for each transform, with the same entities as model(). Every entity is
+     * created up front and then each component is added to all of them in one run, so every entity of a kind takes the
+     * same path through the archetypes one after the other and the storage of each archetype is grown in one go,
+     * rather than jumping between all of them for every instance.
+     * @returns The parent entity of each instance, in the same order as transforms.
+     */
+    template<typename TMaterial>
+    std::vector<Entity> models(
+        ecs::Core &ecs, TransformHierarchy &hierarchy, const ModelPrefab<TMaterial> &prefab,
+        const std::vector<Transform> &transforms)
+    {
+        const std::size_t count = transforms.size();
+        const std::size_t slotCount = prefab.renderInformation.size();
+        
+        hierarchy.reserve(hierarchy.size() + static_cast<uint32_t>(count));
+        std::vector<TransformNode> nodes;
+        nodes.reserve(count);
+        for (const Transform &transform : transforms)
+            nodes.emplace_back(hierarchy.create(transform));
+        
+        std::vector<Entity> parents(count);
+        std::vector<Entity> modelEntities(count);
+        std::vector<Entity> modelSlots(count * slotCount);
+        for (Entity &parent : parents)
+            parent = ecs.create();
+        for (Entity &model : modelEntities)
+            model = ecs.create();
+        for (Entity &modelSlot : modelSlots)
+            modelSlot = ecs.create();
+        
+        for (std::size_t i = 0; i < count; ++i)
+            ecs.add(parents[i], modelEntities[i]);
+        for (std::size_t i = 0; i < count; ++i)
+            ecs.add(parents[i], Position { transforms[i].position });
+        for (std::size_t i = 0; i < count; ++i)
+            ecs.add(parents[i], Rotation { transforms[i].rotation });
+        for (std::size_t i = 0; i < count; ++i)
+            ecs.add(parents[i], Scale { transforms[i].scale });
+        for (std::size_t i = 0; i < count; ++i)
+            ecs.add(parents[i], nodes[i]);
+        
+        // Slots are stored instance by instance, so slot j of instance i is at i * slotCount + j.
+        for (std::size_t i = 0; i < modelSlots.size(); ++i)
+            ecs.add(modelEntities[i / slotCount], modelSlots[i]);
+        for (std::size_t i = 0; i < modelSlots.size(); ++i)
+            ecs.add(modelSlots[i], prefab.tag, prefab.renderInformation[i % slotCount]);
+        for (std::size_t i = 0; i < modelSlots.size(); ++i)
+            ecs.add(modelSlots[i], prefab.materials[i % slotCount]);
+        for (std::size_t i = 0; i < modelSlots.size(); ++i)
+            ecs.add(modelSlots[i], nodes[i / slotCount]);
+        
+        return parents;
+    }
+}
+
+struct ModelSpawnBenchmark
+{
+    uint32_t    modelCount          { 0 };
+    double      singleModelsPerMs   { 0.0 };
+    double      bulkModelsPerMs     { 0.0 };
+};
+
+/**
+ * @brief Times spawning modelCount models of slotCount mesh slots one at a time with spawn::model() against all at once
+ * with spawn::models(). Each run starts with an empty ecs.
+ */
+ModelSpawnBenchmark benchmarkModelSpawn(uint32_t modelCount, uint32_t slotCount=1);
@@ -0,0 +1,95 @@
+/**
+ * @file ParallelForEach.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "Ecs.h"
+#include "WorkStealingPool.h"
+
+#include <tuple>
+#include <type_traits>
+
+template<typename... TComponents>
+using ParallelItems = std::vector<std::tuple<TComponents*...>>;
+
+using SystemSchedule = decltype(ecs::Update);
+
+/**
+ * @brief Collects pointers to the components of every matching entity, ready for the ParallelDispatch that is
+ * created straight after it. Components may be given as const to only hand out read access.
+ */
+template<typename... TComponents>
+class ParallelGather
+    : public ecs::BaseSystem<std::remove_const_t<TComponents>...>
+{
+public:
+    ParallelGather(std::shared_ptr<ParallelItems<TComponents...>> items, const SystemSchedule schedule)
+        : mItems(std::move(items))
+    {
+        this->mEntities.forEach([this](std::remove_const_t<TComponents> &...components) {
+            mItems->emplace_back(&components...);
+        });
+        this->scheduleFor(schedule);
+    }
+    
+    void onUpdate() override
+    {
+        mItems->clear();
+    }
+
+protected:
+    std::shared_ptr<ParallelItems<TComponents...>> mItems;
+};
+
+/**
+ * @brief Runs function over everything gathered this update in chunks of grainSize on a WorkStealingPool. Systems
+ * run in creation order, so by the time onUpdate() is called the gather has already run.
+ */
+template<typename TFunction, typename... TComponents>
+class ParallelDispatch
+    : public ecs::BaseSystem<std::remove_const_t<TComponents>...>
+{
+public:
+    ParallelDispatch(
+        std::shared_ptr<ParallelItems<TComponents...>> items, TFunction function,
+        const uint32_t grainSize, const SystemSchedule schedule, WorkStealingPool *pool)
+        : mItems(std::move(items)), mFunction(std::move(function)), mGrainSize(grainSize), mPool(pool)
+    {
+        // All the work is done in onUpdate().
+        this->mEntities.forEach([](std::remove_const_t<TComponents> &...) {});
+        this->scheduleFor(schedule);
+    }
+    
+    void onUpdate() override
+    {
+        mPool->parallelFor(static_cast<uint32_t>(mItems->size()), mGrainSize, [this](const uint32_t first, const uint32_t last) {
+            for (uint32_t i = first; i < last; ++i)
+                std::apply([this](TComponents *...components) { mFunction(*components...); }, (*mItems)[i]);
+        });
+    }
+
+protected:
+    std::shared_ptr<ParallelItems<TComponents...>> mItems;
+    TFunction           mFunction;
+    uint32_t            mGrainSize;
+    WorkStealingPool    *mPool;
+};
+
+/**
+ * @brief The parallel version of creating a system with mEntities.forEach(function). function is called for every
+ * entity with TComponents, in chunks of grainSize across the pool, so it must only touch the components it is given.
+ */
+template<typename... TComponents, typename TFunction>
+void createParallelSystem(
+    ecs::Core &ecs, const SystemSchedule schedule, const uint32_t grainSize, TFunction function,
+    WorkStealingPool *pool=&WorkStealingPool::instance())
+{
+    auto items = std::make_shared<ParallelItems<TComponents...>>();
+    ecs.createSystem<ParallelGather<TComponents...>>(items, schedule);
+    ecs.createSystem<ParallelDispatch<TFunction, TComponents...>>(items, std::move(function), grainSize, schedule, pool);
+}
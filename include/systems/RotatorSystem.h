@@ -17,10 +17,12 @@
  * @date 15/02/2022
  */
 class RotatorSystem
-        : public ecs::BaseSystem<Rotator, Transform>
+        : public ecs::BaseSystem<Rotator, Position, Rotation>
 {
 public:
     RotatorSystem();
+    
+    static void update(Rotator &rotator, Position &position, Rotation &rotation, float deltaTime);
 };
 
 
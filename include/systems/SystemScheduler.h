@@ -0,0 +1,176 @@
+/**
+ * @file SystemScheduler.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "Ecs.h"
+#include "Components.h"
+#include "ParallelForEach.h"
+
+#include <functional>
+#include <typeindex>
+#include <type_traits>
+
+/**
+ * @brief Runs per-entity systems as a dependency graph rather than in creation order. Each system declares what it
+ * touches through its component types: a const component is only read, anything else is written. A later system
+ * may have to wait for an earlier one when they share a component that one of them writes. These possible hazards
+ * only depend on the declarations, so they are found once and only again after add().
+ * Every tick, a hazard is only kept if both systems gathered a component of that type from overlapping memory. Systems
+ * over disjoint sets of entities (e.g., different tags or archetypes) therefore run together even when they write the
+ * same component type. Systems are split into waves that run one after the other, and every system in a wave runs
+ * concurrently.
+ * Systems that are not added to the scheduler are not part of the graph. They keep their creation order relative to
+ * the SchedulerDispatch, so the dispatch must be created where the scheduled systems should run in the stage.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class SystemScheduler
+{
+public:
+    /**
+     * @param gatherStage - The stage that collects the components of every system. It must run before the stage
+     * that the SchedulerDispatch is in, so that systems can be added at any time.
+     */
+    SystemScheduler(ecs::Core &ecs, SystemSchedule gatherStage, WorkStealingPool *pool=&WorkStealingPool::instance());
+    
+    /**
+     * @brief Adds a system that calls function(components...) for every entity with TComponents, filtered by tags the
+     * same as createSystem(). If function takes a trailing float, it is given the fixed time of the thread that calls
+     * run(), as the pool's workers do not share it.
+     */
+    template<typename... TComponents, typename TFunction>
+    void add(std::string name, TFunction function, std::initializer_list<Component> tags={}, uint32_t grainSize=1024);
+    
+    /**
+     * @brief Runs every system with what was gathered this tick, finding the hazards first if a system was added.
+     */
+    void run();
+    
+    /**
+     * @brief Shows the waves of the last run, how long each system took and why each dependency exists.
+     */
+    void imguiUpdate() const;
+
+protected:
+    /** The memory that a system gathered components of one type from this tick. */
+    struct Footprint
+    {
+        std::type_index component;
+        uintptr_t       first       { std::numeric_limits<uintptr_t>::max() };
+        uintptr_t       last        { 0 };  // One past the end.
+        
+        void include(const void *address, std::size_t size);
+        
+        /** @returns True if both footprints might share an entity. Conservative when entities interleave. */
+        [[nodiscard]] bool overlaps(const Footprint &other) const;
+    };
+    
+    struct Job
+    {
+        std::string                                 name;
+        std::vector<std::type_index>                reads;
+        std::vector<std::type_index>                writes;
+        std::function<uint32_t()>                   size;
+        std::function<std::vector<Footprint>()>     findFootprints;
+        std::function<void(float)>                  run;
+        std::vector<Footprint>                      footprints;
+        uint32_t                                    wave            { 0 };
+        double                                      milliseconds    { 0.0 };
+    };
+    
+    struct Dependency
+    {
+        uint32_t        from;
+        uint32_t        to;
+        std::type_index component;
+        bool            isActive    { true };
+    };
+    
+    /** @brief Finds every pair of systems that could conflict from their declared components alone. */
+    void findHazards();
+    
+    /** @brief Keeps the hazards whose systems touched the same memory this tick and splits the systems into waves. */
+    void buildWaves();
+    
+    ecs::Core                           &mEcs;
+    SystemSchedule                      mGatherStage;
+    WorkStealingPool                    *mPool;
+    
+    std::vector<Job>                    mJobs;
+    std::vector<Dependency>             mDependencies;
+    std::vector<std::vector<uint32_t>>  mWaves;
+    bool                                mHasHazards     { false };
+};
+
+/**
+ * @brief Put on a single entity so that a SchedulerDispatch visits one entity rather than walking a whole component.
+ */
+struct SchedulerEntity
+{
+};
+
+/**
+ * @brief Runs a SystemScheduler at the point in its stage where this system was created. It runs once per
+ * SchedulerEntity, so exactly one entity should have one.
+ */
+class SchedulerDispatch
+    : public ecs::BaseSystem<SchedulerEntity>
+{
+public:
+    SchedulerDispatch(std::shared_ptr<SystemScheduler> scheduler, SystemSchedule schedule);
+
+protected:
+    std::shared_ptr<SystemScheduler> mScheduler;
+};
+
+template<typename... TComponents, typename TFunction>
+void SystemScheduler::add(
+    std::string name, TFunction function, const std::initializer_list<Component> tags, const uint32_t grainSize)
+{
+    auto items = std::make_shared<ParallelItems<TComponents...>>();
+    if (tags.size() == 0)
+        mEcs.createSystem<ParallelGather<TComponents...>>(items, mGatherStage);
+    else
+        mEcs.createSystem<ParallelGather<TComponents...>>(tags, items, mGatherStage);
+    
+    Job job;
+    job.name = std::move(name);
+    ((std::is_const_v<TComponents> ? job.reads : job.writes).emplace_back(typeid(TComponents)), ...);
+    
+    job.size = [items]() { return static_cast<uint32_t>(items->size()); };
+    
+    job.findFootprints = [items]() {
+        std::vector<Footprint> footprints { Footprint { typeid(TComponents) }... };
+        for (const std::tuple<TComponents*...> &item : *items)
+        {
+            std::apply([&](TComponents *...components) {
+                std::size_t i = 0;
+                (footprints[i++].include(components, sizeof(TComponents)), ...);
+            }, item);
+        }
+        return footprints;
+    };
+    
+    job.run = [items, function = std::move(function), grainSize, pool = mPool](const float deltaTime) {
+        pool->parallelFor(static_cast<uint32_t>(items->size()), grainSize, [&](const uint32_t first, const uint32_t last) {
+            for (uint32_t i = first; i < last; ++i)
+            {
+                std::apply([&](TComponents *...components) {
+                    if constexpr (std::is_invocable_v<TFunction &, TComponents &..., float>)
+                        function(*components..., deltaTime);
+                    else
+                        function(*components...);
+                }, (*items)[i]);
+            }
+        });
+    };
+    
+    mJobs.push_back(std::move(job));
+    mHasHazards = false;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file TransformHierarchy.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "Ecs.h"
+#include "Components.h"
+#include "ParallelForEach.h"
+#include "WorkStealingPool.h"
+
+#include <limits>
+#include <optional>
+
+/**
+ * @brief The local transform and world matrix of every object in a scene, stored densely and addressed by
+ * TransformNode. Parents are always stored before their children, so every world matrix is built in one forward pass.
+ * Nodes are only rebuilt when their local transform or their parent has changed.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class TransformHierarchy
+{
+public:
+    static constexpr uint32_t noParent { std::numeric_limits<uint32_t>::max() };
+    
+    /**
+     * @brief Composes translation * rotation * scale directly, without building and multiplying three matrices.
+     */
+    static glm::mat4 localMatrix(const Transform &transform);
+    
+    /**
+     * @brief Adds a node and builds its world matrix straight away, so it can be used before the next update().
+     */
+    TransformNode create(const Transform &local, std::optional<TransformNode> parent=std::nullopt);
+    
+    /**
+     * @brief Allocates room for count nodes in total, so that creating many nodes at once never reallocates.
+     */
+    void reserve(uint32_t count);
+    
+    /**
+     * @brief Sets the transform of node relative to its parent. Different nodes may be set from different threads.
+     */
+    void setLocal(TransformNode node, const Transform &local) { mLocal[node.index] = local; }
+    
+    /**
+     * @brief Builds the world matrix of node now and never updates it again. Only use this for things that will never
+     * move, and never on the child of something that moves.
+     */
+    void makeStatic(TransformNode node);
+    
+    /**
+     * @brief Copies every node that source has made since the last call, and every node that source has made static
+     * since, so that this can be a copy of source that is updated separately (e.g., from another thread).
+     */
+    void mirror(const TransformHierarchy &source);
+    
+    /**
+     * @brief Rebuilds the world matrix of every node whose local transform or parent has changed. Local matrices are
+     * built in chunks of grainSize on pool, then children are multiplied by their parents in a single forward pass.
+     */
+    void update(WorkStealingPool *pool=&WorkStealingPool::instance(), uint32_t grainSize=1024);
+    
+    [[nodiscard]] const glm::mat4 &world(const TransformNode node) const { return mWorld[node.index]; }
+    [[nodiscard]] const Transform &local(const TransformNode node) const { return mLocal[node.index]; }
+    [[nodiscard]] bool isStatic(const TransformNode node) const { return mStatic[node.index]; }
+    [[nodiscard]] uint32_t parent(const TransformNode node) const { return mParents[node.index]; }
+    [[nodiscard]] uint32_t size() const { return static_cast<uint32_t>(mParents.size()); }
+
+protected:
+    std::vector<uint32_t>   mParents;
+    std::vector<Transform>  mLocal;
+    
+    /** The local transform that each local matrix was last built from. */
+    std::vector<Transform>  mSource;
+    std::vector<glm::mat4>  mLocalMatrices;
+    std::vector<glm::mat4>  mWorld;
+    std::vector<uint8_t>    mChanged;
+    std::vector<uint8_t>    mStatic;
+    
+    /** Every node that has a parent, in the order they are stored. */
+    std::vector<uint32_t>   mChildren;
+};
+
+/**
+ * @brief Calls TransformHierarchy::update() once for every update of schedule. Must be created after the systems that
+ * set the local transforms for that schedule, as systems run in creation order.
+ */
+class TransformHierarchyUpdater
+    : public ecs::BaseSystem<TransformNode>
+{
+public:
+    TransformHierarchyUpdater(
+        std::shared_ptr<TransformHierarchy> hierarchy, SystemSchedule schedule,
+        WorkStealingPool *pool=&WorkStealingPool::instance());
+    
+    void onUpdate() override;
+
+protected:
+    std::shared_ptr<TransformHierarchy> mHierarchy;
+    WorkStealingPool                    *mPool;
+};
+
+struct GeometryPassBenchmark
+{
+    uint32_t    slotCount           { 0 };
+    double      sharedPointerMs     { 0.0 };
+    double      hierarchyMs         { 0.0 };
+    
+    /** Last level cache misses of one pass, if the platform lets us read the hardware counters. */
+    std::optional<uint64_t> sharedPointerMisses;
+    std::optional<uint64_t> hierarchyMisses;
+};
+
+/**
+ * @brief Times the CPU side of the geometry pass (fetching every mesh slot's matrix and building its mvp) when each
+ * model's matrix is a separate heap allocation, against looking them up by node in a TransformHierarchy.
+ */
+GeometryPassBenchmark benchmarkGeometryPass(uint32_t slotCount=50'000, uint32_t steps=10);
@@ -0,0 +1,83 @@
+/**
+ * @file TransformSnapshots.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+#include "Ecs.h"
+#include "Components.h"
+#include "TransformHierarchy.h"
+
+#include <mutex>
+
+/**
+ * @brief The transforms of the last two fixed ticks, so that rendering can interpolate between them rather than
+ * showing the simulation in steps of the fixed time. Transforms are indexed by their node in the TransformHierarchy.
+ * The fixed update thread writes and publishes, the render thread acquires and interpolates. Only publishing and
+ * acquiring lock, and only long enough to swap a buffer.
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+class TransformSnapshots
+{
+public:
+    /** @brief Records transform for the tick in progress. Fixed update thread only. */
+    void write(TransformNode node, const Transform &transform);
+    
+    /**
+     * @brief Hands everything written since the last publish over to the render thread. Fixed update thread only.
+     */
+    void publish();
+    
+    /**
+     * @brief Makes the latest published snapshot the current one, if there has been one since the last acquire. The
+     * old current becomes previous. Render thread only.
+     */
+    void acquire();
+    
+    /**
+     * @brief Interpolates between the previous and current snapshot by how far the current time is into the next tick.
+     * Render thread only, though any number of threads may interpolate at once.
+     * @returns False if the transform is not in both snapshots (e.g., it was created during the last tick).
+     */
+    bool interpolate(TransformNode node, Transform &transform) const;
+
+protected:
+    struct Snapshot
+    {
+        /** Indexed by node. Nodes are only ever appended, so every node below the size has been written. */
+        std::vector<Transform> transforms;
+        double time { 0.0 };
+    };
+    
+    Snapshot    mNext;
+    
+    /** The only snapshot that both threads touch. */
+    Snapshot    mPublished;
+    bool        mIsPublished    { false };
+    std::mutex  mMutex;
+    
+    Snapshot    mPrevious;
+    Snapshot    mCurrent;
+};
+
+/**
+ * @brief Writes every transform into the snapshots each fixed tick. Created before any physics system, so it records
+ * the state that the previous tick finished with. The snapshot is published by the scene once the tick has finished.
+ * The live transforms are also set on the hierarchy of the simulation, which collision reads. A
+ * TransformHierarchyUpdater must be created after it to rebuild the matrices.
+ */
+class TransformSnapshotWriter
+    : public ecs::BaseSystem<TransformNode, Position, Rotation, Scale>
+{
+public:
+    TransformSnapshotWriter(std::shared_ptr<TransformSnapshots> snapshots, std::shared_ptr<TransformHierarchy> hierarchy);
+
+protected:
+    std::shared_ptr<TransformSnapshots> mSnapshots;
+    std::shared_ptr<TransformHierarchy> mHierarchy;
+};
@@ -0,0 +1,34 @@
+/**
+ * @file TransformStreams.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+
+struct TransformStreamBenchmark
+{
+    struct System
+    {
+        const char  *name                   { "" };
+        
+        /** Every entity stores one Transform, so each system brings all of it into cache. */
+        double      transformEntitiesPerMs  { 0.0 };
+        
+        /** Every entity stores separate Position, Rotation and Scale components. */
+        double      streamEntitiesPerMs     { 0.0 };
+    };
+    
+    uint32_t            entityCount { 0 };
+    std::vector<System> systems;
+};
+
+/**
+ * @brief Times the linear and angular integrators, the rotator and the model matrix updater when the transform of each
+ * entity is a single component against when it is split into position, rotation and scale streams. Every component
+ * type has its own dense array, as it does in the ecs.
+ */
+TransformStreamBenchmark benchmarkTransformStreams(uint32_t entityCount=100'000, uint32_t steps=10);
@@ -4,17 +4,36 @@ layout (location = 0) in vec3 a_position;
 layout (location = 1) in vec2 a_uvs;
 layout (location = 2) in vec3 a_normal;
 
-uniform mat4 u_mvp;
-uniform mat4 u_model_matrix;
+struct Instance
+{
+    mat4 model_matrix;
+    vec4 colour;
+};
+
+layout(std430, binding = 0) readonly buffer Instances
+{
+    Instance instances[];
+};
+
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_vp;
+    vec3 u_camera_position_ws;
+};
 
 out vec3 v_position_ws;
 out vec2 v_uvs;
 out vec3 v_normal_ws;
+flat out vec3 v_colour;
 
 void main()
 {
-    gl_Position = u_mvp * vec4(a_position.xyz, 1.f);
+    // Each group of instances starts at its base instance within the buffer.
+    Instance instance = instances[gl_BaseInstance + gl_InstanceID];
+
+    v_position_ws = vec3(instance.model_matrix * vec4(a_position.xyz, 1.f));
+    gl_Position = u_vp * vec4(v_position_ws, 1.f);
     v_uvs = a_uvs;
-    v_normal_ws = mat3(u_model_matrix) * a_normal;
-    v_position_ws = vec3(u_model_matrix * vec4(a_position.xyz, 1.f));
+    v_normal_ws = mat3(instance.model_matrix) * a_normal;
+    v_colour = instance.colour.rgb;
 }
\ No newline at end of file
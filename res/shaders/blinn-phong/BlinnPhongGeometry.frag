@@ -3,8 +3,8 @@
 in      vec2        v_uvs;
 in      vec3        v_normal_ws;
 in      vec3        v_position_ws;
+flat in vec3        v_colour;
 
-uniform vec3        u_colour;
 uniform sampler2D   u_texture;
 
 layout(location = 0) out vec3 o_position_ws;
@@ -20,5 +20,5 @@ void main()
     if (diffuse_map == vec3(0.0))
         diffuse_map = vec3(1.0);
 
-    o_albedo = u_colour * diffuse_map;
+    o_albedo = v_colour * diffuse_map;
 }
@@ -3,8 +3,8 @@
 in      vec2        v_uvs;
 in      vec3        v_normal_ws;
 in      vec3        v_position_ws;
+flat in vec3        v_colour;
 
-uniform vec3        u_colour;
 uniform sampler2D   u_diffuse_texture;
 uniform sampler2D   u_emissive_texture;
 
@@ -21,6 +21,6 @@ void main()
 
     o_position_ws   = v_position_ws;
     o_normal_ws     = v_normal_ws;
-    o_albedo        = u_colour * diffuse_map;
+    o_albedo        = v_colour * diffuse_map;
     o_emissive      = texture(u_emissive_texture, v_uvs).rgb;
 }
@@ -0,0 +1,85 @@
+#version 460 core
+
+// Must match ClusteredLighting.h and Clusters.comp.
+#define GRID_X 16
+#define GRID_Y 9
+#define GRID_Z 24
+#define MAX_LIGHTS_PER_CLUSTER 256
+
+in vec2 v_uvs;
+
+struct PointLight
+{
+    vec3  position_ws;
+    float distance;
+    vec3  intensity;
+    float power;
+    vec3  position_vs;
+    float padding;
+};
+
+layout(std430, binding = 0) readonly buffer Lights { PointLight lights[]; };
+layout(std430, binding = 1) readonly buffer ClusterCounts { uint cluster_counts[]; };
+layout(std430, binding = 2) readonly buffer ClusterLights { uint cluster_lights[]; };
+
+uniform sampler2D u_positions;
+uniform sampler2D u_normals;
+uniform sampler2D u_albedo;
+
+uniform mat4  u_view;
+uniform float u_near;
+uniform float u_far;
+
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_vp;
+    vec3 u_camera_position_ws;
+};
+
+out layout(location = 0) vec3 o_diffuse;
+out layout(location = 1) vec3 o_specular;
+
+float light_dot(vec3 a, vec3 b)
+{
+    return max(dot(a, b), 0.f);
+}
+
+void main()
+{
+    o_diffuse = vec3(0.f);
+    o_specular = vec3(0.f);
+    
+    // The geometry buffer is read once, however many lights reach this pixel.
+    const vec3 normal   = texture(u_normals, v_uvs).rgb;
+    const vec3 albedo   = texture(u_albedo, v_uvs).rgb;
+    const vec3 position = texture(u_positions, v_uvs).rgb;
+    if (dot(normal, normal) == 0.f)
+        return;  // Nothing was drawn here.
+    
+    const vec3 camera_direction = normalize(u_camera_position_ws - position);
+    
+    const float depth = -(u_view * vec4(position, 1.f)).z;
+    const float slice = log(max(depth, u_near) / u_near) / log(u_far / u_near) * GRID_Z;
+    const uvec3 cluster = min(
+        uvec3(uvec2(v_uvs * vec2(GRID_X, GRID_Y)), uint(slice)), uvec3(GRID_X - 1, GRID_Y - 1, GRID_Z - 1));
+    const uint index = cluster.x + cluster.y * GRID_X + cluster.z * GRID_X * GRID_Y;
+    
+    const uint count = cluster_counts[index];
+    for (uint i = 0; i < count; ++i)
+    {
+        const PointLight light = lights[cluster_lights[index * MAX_LIGHTS_PER_CLUSTER + i]];
+        
+        const vec3 distance3 = light.position_ws - position;
+        const float distance = length(distance3);
+        if (distance > light.distance)
+            continue;
+        
+        // The same lighting as PointLighting.frag, so that both paths look alike.
+        const vec3 direction = distance3 / distance;
+        const vec3 intensity = light.intensity * light.power / 1.f - (distance / light.distance);
+        const vec3 half_angle = normalize(camera_direction + direction);
+        
+        o_diffuse  += albedo * light_dot(normal, direction) * intensity;
+        o_specular += albedo * pow(light_dot(half_angle, normal), 128.f) * intensity;
+    }
+}
@@ -5,7 +5,11 @@ in vec2 v_uvs;
 uniform vec3 u_light_direction;
 uniform vec3 u_light_intensity;
 
-uniform vec3 u_camera_position_ws;
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_vp;
+    vec3 u_camera_position_ws;
+};
 
 uniform sampler2D u_positions;
 uniform sampler2D u_normals;
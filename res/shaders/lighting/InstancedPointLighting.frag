@@ -0,0 +1,57 @@
+#version 460 core
+
+flat in int v_light;
+
+struct PointLight
+{
+    vec3  position_ws;
+    float distance;
+    vec3  intensity;
+    float power;
+};
+
+layout(std430, binding = 0) readonly buffer Lights { PointLight lights[]; };
+
+uniform sampler2D u_positions;
+uniform sampler2D u_normals;
+uniform sampler2D u_albedo;
+
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_vp;
+    vec3 u_camera_position_ws;
+};
+
+out layout(location = 0) vec3 o_diffuse;
+out layout(location = 1) vec3 o_specular;
+
+float light_dot(vec3 a, vec3 b)
+{
+    return max(dot(a, b), 0.f);
+}
+
+void main()
+{
+    // Read by pixel, as the screen position of a volume does not interpolate linearly across it.
+    const ivec2 pixel = ivec2(gl_FragCoord.xy);
+    const PointLight light = lights[v_light];
+    const vec3 position = texelFetch(u_positions, pixel, 0).rgb;
+    
+    const vec3 distance3 = light.position_ws - position;
+    const float distance = length(distance3);
+    
+    // The depth test only rejects surfaces behind the volume, so surfaces in front of it are skipped here.
+    if (distance > light.distance)
+        discard;
+    
+    const vec3 normal = texelFetch(u_normals, pixel, 0).rgb;
+    const vec3 albedo = texelFetch(u_albedo, pixel, 0).rgb;
+    
+    // The same lighting as PointLighting.frag, so that every path looks alike.
+    const vec3 direction = distance3 / distance;
+    const vec3 intensity = light.intensity * light.power / 1.f - (distance / light.distance);
+    const vec3 half_angle = normalize(normalize(u_camera_position_ws - position) + direction);
+    
+    o_diffuse  = albedo * light_dot(normal, direction) * intensity;
+    o_specular = albedo * pow(light_dot(half_angle, normal), 128.f) * intensity;
+}
@@ -0,0 +1,30 @@
+#version 460 core
+
+layout (location = 0) in vec3 a_position;
+
+// Must match VolumeLight in InstancedLightVolumes.h.
+struct PointLight
+{
+    vec3  position_ws;
+    float distance;
+    vec3  intensity;
+    float power;
+};
+
+layout(std430, binding = 0) readonly buffer Lights { PointLight lights[]; };
+
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_vp;
+    vec3 u_camera_position_ws;
+};
+
+flat out int v_light;
+
+void main()
+{
+    const PointLight light = lights[gl_InstanceID];
+    
+    gl_Position = u_vp * vec4(light.position_ws + a_position * light.distance, 1.f);
+    v_light = gl_InstanceID;
+}
@@ -13,7 +13,11 @@ uniform float u_light_distance;
 uniform vec3 u_light_intensity;
 uniform float u_light_power;
 
-uniform vec3 u_camera_position_ws;
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_vp;
+    vec3 u_camera_position_ws;
+};
 
 out layout(location = 0) vec3 o_diffuse;
 out layout(location = 1) vec3 o_specular;
@@ -2,7 +2,11 @@
 
 in vec3 v_position_ws;
 
-uniform vec3 u_camera_position_ws;
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_vp;
+    vec3 u_camera_position_ws;
+};
 
 layout (location = 0) out vec3 o_position_ws;
 layout (location = 1) out vec3 o_normal_ws;
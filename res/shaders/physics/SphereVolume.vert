@@ -3,7 +3,12 @@
 layout (location = 0) in vec3 a_position;
 layout (location = 1) in vec3 a_uvs;
 
-uniform mat4    u_mvp;
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_vp;
+    vec3 u_camera_position_ws;
+};
+
 uniform mat4    u_model_matrix;
 uniform float   u_radius;
 
@@ -11,6 +16,6 @@ out vec3 v_position_ws;
 
 void main()
 {
-    gl_Position = u_mvp * vec4(u_radius * a_position.xyz, 1.f);
     v_position_ws = (u_model_matrix * vec4(u_radius * a_position.xyz, 1.f)).xyz;
+    gl_Position = u_vp * vec4(v_position_ws, 1.f);
 }
\ No newline at end of file
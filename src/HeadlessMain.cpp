@@ -0,0 +1,168 @@
+/**
+ * @file HeadlessMain.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "Pch.h"
+#include "WorldBatch.h"
+#include "PhysicsSystems.h"
+#include "Physics.h"
+#include "Components.h"
+#include "Timers.h"
+
+/**
+ * Runs the physics of a scene without a window for as many ticks as asked, as fast as possible. Every option is given
+ * as --name value:
+ *   --scenario    ode (the five balls of the ODE demo) or rain (a grid of spheres falling onto the floor).
+ *   --ticks       The number of fixed updates to run.
+ *   --bodies      The number of spheres for rain.
+ *   --integrator  euler, rk2, rk4 or rkN (with --degree) for rain. dormandPrince is rejected there, as it only
+ *                 integrates bodies with a Spring and an AdaptiveStep, like the fifth ball of ode.
+ *   --bounciness  The bounciness of every sphere in rain. With several worlds, world i uses bounciness * (i + 1) / worlds.
+ *   --worlds      The number of independent worlds to run.
+ *   --threads     The number of threads to run the worlds on (0 for the engine's shared pool).
+ *   --timing      Where the time of each tick of every world is written to.
+ *   --state       Where the final position and velocity of every body is written to.
+ */
+namespace
+{
+    using Options = std::unordered_map<std::string, std::string>;
+    
+    Options parseOptions(const int argc, char *argv[])
+    {
+        Options options {
+            { "scenario",   "ode" },
+            { "ticks",      "1000" },
+            { "bodies",     "100" },
+            { "integrator", "euler" },
+            { "degree",     "4" },
+            { "bounciness", "0.5" },
+            { "worlds",     "1" },
+            { "threads",    "0" },
+            { "timing",     "timing.csv" },
+            { "state",      "state.csv" },
+        };
+        
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            const std::string_view name(argv[i]);
+            if (name.substr(0, 2) != "--" || options.count(std::string(name.substr(2))) == 0)
+                throw std::invalid_argument("Unknown option " + std::string(name));
+            options[std::string(name.substr(2))] = argv[i + 1];
+        }
+        
+        return options;
+    }
+    
+    void createIntegrator(ecs::Core &ecs, const Component tag, const std::string &integrator, const uint32_t degree)
+    {
+        ecs.createSystem<Gravity>({ tag });
+        if (integrator == "euler")
+            ecs.createSystem<LinearEulerMethod>({ tag });
+        else if (integrator == "rk2")
+            ecs.createSystem<LinearRk2>({ tag });
+        else if (integrator == "rk4")
+            ecs.createSystem<LinearRk4>({ tag });
+        else if (integrator == "rkN")
+            ecs.createSystem<LinearRkN>({ tag }, degree);
+        else if (integrator == "dormandPrince")
+            ecs.createSystem<LinearDormandPrince>({ tag });
+        else
+            throw std::invalid_argument("Unknown integrator " + integrator);
+    }
+    
+    std::vector<Entity> setupOde(PhysicsWorld &world, const uint32_t degree)
+    {
+        ecs::Core &ecs = world.ecs();
+        std::vector<Entity> bodies;
+        float x = -6.f;
+        for (const std::string integrator : { "euler", "rk2", "rk4", "rkN" })
+        {
+            const Component tag = ecs.create<DynamicObject>();
+            bodies.push_back(world.createSphere(glm::vec3(x, 5.f, 0.f), tag));
+            createIntegrator(ecs, tag, integrator, degree);
+            x += 4.f;
+        }
+        
+        const Component adaptiveTag = ecs.create<DynamicObject>();
+        bodies.push_back(world.createSphere(glm::vec3(10.f, 5.f, 0.f), adaptiveTag));
+        ecs.add(bodies.back(), Spring { glm::vec3(10.f, 8.f, 0.f), 2.f, 2e5f, 50.f });
+        ecs.add(bodies.back(), AdaptiveStep());
+        createIntegrator(ecs, adaptiveTag, "dormandPrince", degree);
+        
+        return bodies;
+    }
+    
+    std::vector<Entity> setupRain(PhysicsWorld &world, const Options &options, const float bounciness)
+    {
+        const uint32_t bodyCount = std::stoul(options.at("bodies"));
+        const Component tag = world.ecs().create<DynamicObject>();
+        
+        // Spheres are laid out in layers of 16x16 so that they stay within the floor.
+        constexpr uint32_t width { 16 };
+        constexpr float spacing { 2.5f };
+        std::vector<Entity> bodies;
+        for (uint32_t i = 0; i < bodyCount; ++i)
+        {
+            const glm::vec3 position(
+                (static_cast<float>(i % width) - width / 2.f) * spacing,
+                5.f + static_cast<float>(i / (width * width)) * spacing,
+                (static_cast<float>(i / width % width) - width / 2.f) * spacing);
+            bodies.push_back(world.createSphere(position, tag, 100.f, bounciness));
+        }
+        
+        createIntegrator(world.ecs(), tag, options.at("integrator"), std::stoul(options.at("degree")));
+        return bodies;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    try
+    {
+        const Options options = parseOptions(argc, argv);
+        const uint32_t ticks = std::stoul(options.at("ticks"));
+        const uint32_t worldCount = std::stoul(options.at("worlds"));
+        const uint32_t threadCount = std::stoul(options.at("threads"));
+        const std::string &scenario = options.at("scenario");
+        if (scenario != "ode" && scenario != "rain")
+            throw std::invalid_argument("Unknown scenario " + scenario);
+        if (scenario == "rain" && options.at("integrator") == "dormandPrince")
+            throw std::invalid_argument("Integrator dormandPrince needs bodies with a Spring and AdaptiveStep");
+        
+        WorldBatch batch(worldCount, [&](PhysicsWorld &world, const uint32_t worldIndex) {
+            world.createFloor();
+            world.createCollisionSystems();
+            world.ecs().createSystem<LinearKinematicSystem>();
+            
+            if (scenario == "ode")
+                return setupOde(world, std::stoul(options.at("degree")));
+            
+            const float sweep = static_cast<float>(worldIndex + 1) / static_cast<float>(worldCount);
+            return setupRain(world, options, std::stof(options.at("bounciness")) * sweep);
+        });
+        
+        // The calling thread also runs worlds, so a pool of one fewer worker gives threadCount threads.
+        std::unique_ptr<WorkStealingPool> pool;
+        if (threadCount > 0)
+            pool = std::make_unique<WorkStealingPool>(threadCount - 1);
+        
+        const double total = timers::measure([&]() {
+            batch.run(ticks, pool ? pool.get() : &WorkStealingPool::instance());
+        });
+        batch.writeCsv(options.at("state"), options.at("timing"));
+        
+        debug::log(
+            "Ran " + std::to_string(ticks) + " ticks of " + std::to_string(worldCount) + " " + scenario
+            + " worlds in " + std::to_string(total) + "ms");
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    
+    return 0;
+}
@@ -0,0 +1,47 @@
+/**
+ * @file BatchIds.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "BatchIds.h"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+namespace batch
+{
+    namespace
+    {
+        uint32_t checked(const uint32_t id, const uint32_t bits, const std::string_view name)
+        {
+            if (id >= (1u << bits))
+                debug::log("Ran out of " + std::string(name) + " ids for geometry batching.", debug::severity::Fatal);
+            return id;
+        }
+    }
+    
+    uint32_t nextMeshId()
+    {
+        static std::atomic<uint32_t> nextId { 0 };
+        return checked(nextId++, meshBits, "mesh");
+    }
+    
+    uint32_t nextVaoId()
+    {
+        static std::atomic<uint32_t> nextId { 0 };
+        return checked(nextId++, vaoBits, "vao");
+    }
+    
+    uint32_t materialId(const unsigned int firstTexture, const unsigned int secondTexture)
+    {
+        static std::mutex mutex;
+        static std::map<std::pair<unsigned int, unsigned int>, uint32_t> ids { { { 0, 0 }, 0 } };
+        
+        std::scoped_lock lock(mutex);
+        const auto id = static_cast<uint32_t>(ids.size());
+        return checked(ids.try_emplace({ firstTexture, secondTexture }, id).first->second, materialBits, "material");
+    }
+}
@@ -28,3 +28,11 @@ void setVaoLayout(unsigned int vao, const Instructions &instructions)
         ++attributeIndex;
     }
 }
+
+void drawElements(const RenderInformation &renderInformation, const GLenum mode)
+{
+    const auto firstIndex = static_cast<std::uintptr_t>(renderInformation.firstIndex) * sizeof(uint32_t);
+    glDrawElementsBaseVertex(
+        mode, renderInformation.eboCount, GL_UNSIGNED_INT, reinterpret_cast<const void *>(firstIndex),
+        renderInformation.baseVertex);
+}
@@ -0,0 +1,145 @@
+/**
+ * @file MeshBuffer.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "MeshBuffer.h"
+#include "Mesh.h"
+#include "BatchIds.h"
+
+namespace
+{
+    /** Enough for a few of the demo models before the buffers need to grow. */
+    constexpr uint32_t initialCapacity { 1u << 16 };
+}
+
+MeshBuffer::MeshBuffer(const uint32_t vertexSize, const Instructions &instructions)
+    : mVaoId(batch::nextVaoId())
+{
+    mVertices.elementSize = vertexSize;
+    mIndices.elementSize = sizeof(uint32_t);
+    grow(mVertices, initialCapacity);
+    grow(mIndices, initialCapacity);
+    
+    glCreateVertexArrays(1, &mVao);
+    setVaoLayout(mVao, instructions);
+    glVertexArrayVertexBuffer(mVao, 0, mVertices.buffer, 0, static_cast<int>(vertexSize));
+    glVertexArrayElementBuffer(mVao, mIndices.buffer);
+}
+
+MeshBuffer::Range MeshBuffer::allocate(
+    const void *vertices, const uint32_t vertexCount, const void *indices, const uint32_t indexCount)
+{
+    const unsigned int vertexBuffer = mVertices.buffer;
+    const unsigned int indexBuffer = mIndices.buffer;
+    
+    Range range;
+    range.firstVertex = allocate(mVertices, vertices, vertexCount);
+    range.vertexCount = vertexCount;
+    range.firstIndex = allocate(mIndices, indices, indexCount);
+    range.indexCount = indexCount;
+    
+    // Growing replaces a buffer, so the vao has to be pointed at the new one.
+    if (vertexBuffer != mVertices.buffer)
+        glVertexArrayVertexBuffer(mVao, 0, mVertices.buffer, 0, static_cast<int>(mVertices.elementSize));
+    if (indexBuffer != mIndices.buffer)
+        glVertexArrayElementBuffer(mVao, mIndices.buffer);
+    
+    return range;
+}
+
+void MeshBuffer::release(const Range &range)
+{
+    release(mVertices, range.firstVertex, range.vertexCount);
+    release(mIndices, range.firstIndex, range.indexCount);
+}
+
+unsigned int MeshBuffer::vao() const
+{
+    return mVao;
+}
+
+uint32_t MeshBuffer::vaoId() const
+{
+    return mVaoId;
+}
+
+uint32_t MeshBuffer::allocate(Arena &arena, const void *data, const uint32_t count)
+{
+    if (count == 0)
+        return 0;
+    
+    auto block = std::find_if(arena.freeBlocks.begin(), arena.freeBlocks.end(), [count](const FreeBlock &freeBlock) {
+        return freeBlock.count >= count;
+    });
+    
+    if (block == arena.freeBlocks.end())
+    {
+        grow(arena, count);
+        block = arena.freeBlocks.end() - 1;  // Growing always leaves the new space in the last block.
+    }
+    
+    const uint32_t offset = block->offset;
+    block->offset += count;
+    block->count -= count;
+    if (block->count == 0)
+        arena.freeBlocks.erase(block);
+    
+    glNamedBufferSubData(
+        arena.buffer, static_cast<GLintptr>(offset) * arena.elementSize,
+        static_cast<GLsizeiptr>(count) * arena.elementSize, data);
+    
+    return offset;
+}
+
+void MeshBuffer::release(Arena &arena, const uint32_t offset, const uint32_t count)
+{
+    if (count == 0)
+        return;
+    
+    // Keeps the blocks sorted and merges them with their neighbours so that space is not lost to fragments.
+    const auto isBefore = [](const FreeBlock &block, const uint32_t value) { return block.offset < value; };
+    auto next = std::lower_bound(arena.freeBlocks.begin(), arena.freeBlocks.end(), offset, isBefore);
+    next = arena.freeBlocks.insert(next, FreeBlock { offset, count });
+    
+    if (next + 1 != arena.freeBlocks.end() && next->offset + next->count == (next + 1)->offset)
+    {
+        next->count += (next + 1)->count;
+        arena.freeBlocks.erase(next + 1);
+    }
+    
+    if (next != arena.freeBlocks.begin() && (next - 1)->offset + (next - 1)->count == next->offset)
+    {
+        (next - 1)->count += next->count;
+        arena.freeBlocks.erase(next);
+    }
+}
+
+void MeshBuffer::grow(Arena &arena, const uint32_t minimumCount)
+{
+    const uint32_t oldCapacity = arena.capacity;
+    const uint32_t newCapacity = std::max(oldCapacity * 2, oldCapacity + minimumCount);
+    
+    unsigned int buffer { 0 };
+    glCreateBuffers(1, &buffer);
+    glNamedBufferStorage(
+        buffer, static_cast<GLsizeiptr>(newCapacity) * arena.elementSize, nullptr, GL_DYNAMIC_STORAGE_BIT);
+    
+    if (arena.buffer != 0)
+    {
+        glCopyNamedBufferSubData(
+            arena.buffer, buffer, 0, 0, static_cast<GLsizeiptr>(oldCapacity) * arena.elementSize);
+        glDeleteBuffers(1, &arena.buffer);
+    }
+    
+    arena.buffer = buffer;
+    arena.capacity = newCapacity;
+    
+    // The new space has to be at the end, so the free block of it must be as well.
+    if (!arena.freeBlocks.empty() && arena.freeBlocks.back().offset + arena.freeBlocks.back().count == oldCapacity)
+        arena.freeBlocks.back().count += newCapacity - oldCapacity;
+    else
+        arena.freeBlocks.push_back({ oldCapacity, newCapacity - oldCapacity });
+}
@@ -19,6 +19,9 @@
 #include "scenes/OdeDemoScene.h"
 #include "scenes/RotationDemoScene.h"
 #include "WindowHelpers.h"
+#include "Shader.h"
+
+#include <chrono>
 
 Core::Core(const glm::ivec2 &resolution)
     : mResolution(resolution)
@@ -30,11 +33,12 @@ Core::Core(const glm::ivec2 &resolution)
         return;
     }
     window::setBufferSize(resolution);
-    mScene = std::make_unique<BloomSceneDemo>();  // Scenes must be made after the initialisation of underlying architectures.
+    loadScene(Level::Bloom);  // Scenes must be made after the initialisation of underlying architectures.
 }
 
 Core::~Core()
 {
+    stopPhysics();
     mScene.reset();
     ImGui_ImplGlfw_Shutdown();
     ImGui_ImplOpenGL3_Shutdown();
@@ -44,28 +48,83 @@ Core::~Core()
 void Core::run()
 {
     double nextUpdateTick = 0.0;
+    if (mThreadedPhysics && mIsRunning)
+        startPhysics();
     
     while (mIsRunning)
     {
-        unsigned int loopAmount = 0;
-        
-        while (timers::getTicks<double>() > nextUpdateTick && loopAmount < mMaxLoopCount)
         {
-            mScene->onFixedUpdate();
-    
-            glfwPollEvents();
-            mIsRunning = !glfwWindowShouldClose(mWindow);
+            // Scene logic, rendering and ImGui all use the ecs, so the physics thread waits for them.
+            std::scoped_lock lock(mScene->simulationMutex());
+            
+            unsigned int loopAmount = 0;
+            while (!mThreadedPhysics && timers::getTicks<double>() > nextUpdateTick && loopAmount < mMaxLoopCount)
+            {
+                mScene->onFixedUpdate();
+                nextUpdateTick += timers::fixedTime<double>();
+                ++loopAmount;
+            }
+            
+            mScene->onUpdate();
+            mScene->syncRender();
             
-            nextUpdateTick += timers::fixedTime<double>();
-            ++loopAmount;
+            // Rendering still walks the ecs that the fixed update writes to, so it keeps the lock. ImGui edits the
+            // simulation directly.
+            mScene->updateRenderTransforms();
+            mScene->onRender();
+            updateImgui();
         }
         
-        mScene->onUpdate();
-        mScene->onRender();
-        updateImgui();
+        glfwPollEvents();
+        mIsRunning = !glfwWindowShouldClose(mWindow);
         
         glfwSwapBuffers(mWindow);
         timers::update();
+        changeScene();
+    }
+    
+    stopPhysics();
+}
+
+void Core::startPhysics()
+{
+    if (mPhysicsRunning)
+        return;
+    
+    mPhysicsRunning = true;
+    mPhysicsThread = std::thread(&Core::runPhysics, this);
+}
+
+void Core::stopPhysics()
+{
+    mPhysicsRunning = false;
+    if (mPhysicsThread.joinable())
+        mPhysicsThread.join();
+}
+
+void Core::runPhysics()
+{
+    const double fixedTime = timers::fixedTime<double>();
+    double nextUpdateTick = timers::getTicks<double>();
+    
+    while (mPhysicsRunning)
+    {
+        const double now = timers::getTicks<double>();
+        if (now < nextUpdateTick)
+        {
+            std::this_thread::sleep_for(std::chrono::duration<double>(nextUpdateTick - now));
+            continue;
+        }
+        
+        // Drop the missed time rather than trying to catch up forever (e.g., after hitting a breakpoint).
+        if (now - nextUpdateTick > mMaxLoopCount * fixedTime)
+            nextUpdateTick = now;
+        
+        {
+            std::scoped_lock lock(mScene->simulationMutex());
+            mScene->onFixedUpdate();
+        }
+        nextUpdateTick += fixedTime;
     }
 }
 
@@ -125,6 +184,9 @@ bool Core::initOpenGl()
     
     debug::log(glGetString(GL_VERSION), debug::severity::Notification);
     
+    if (!Shader::enableParallelCompile())
+        debug::log("Parallel shader compiling is not supported.", debug::severity::Notification);
+    
     // Blending texture data / enabling lerping.
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
@@ -171,36 +233,48 @@ void Core::updateImgui()
     glBindVertexArray(0);
     ImGui::DockSpaceOverViewport(ImGui::GetMainViewport());
     
-    enum class Level { None, Impulse, Octree, Platforms, Dynamic, Ode, Rotation, Bloom };
-    static Level type = Level::None;
-    
     if (ImGui::BeginMainMenuBar())
     {
         if (ImGui::BeginMenu("Scenes"))
         {
             if (ImGui::MenuItem("Impulse Demo"))
-                type = Level::Impulse;
+                mNextLevel = Level::Impulse;
             
             if (ImGui::MenuItem("Octree Demo"))
-                type = Level::Octree;
+                mNextLevel = Level::Octree;
                 
             if (ImGui::MenuItem("Platforms Demo"))
-                type = Level::Platforms;
+                mNextLevel = Level::Platforms;
             
             if (ImGui::MenuItem("Dynamic Impulse Demo"))
-                type = Level::Dynamic;
+                mNextLevel = Level::Dynamic;
     
             if (ImGui::MenuItem("ODE Demo"))
-                type = Level::Ode;
+                mNextLevel = Level::Ode;
             
             if (ImGui::MenuItem("Rotation Demo"))
-                type = Level::Rotation;
+                mNextLevel = Level::Rotation;
             
             if (ImGui::MenuItem("Bloom Scene"))
-                type = Level::Bloom;
+                mNextLevel = Level::Bloom;
                 
             ImGui::EndMenu();
         }
+        
+        if (ImGui::BeginMenu("Shaders"))
+        {
+            const ProgramStats &stats = Shader::programStats();
+            ImGui::Text(
+                "Scene Load Time: %.1fms (%.1fms making programs, %.1fms waiting for them to compile)",
+                mSceneLoadTime, stats.milliseconds, stats.waitMilliseconds);
+            ImGui::Text(
+                "Programs: %u compiled, %u loaded from the cache, %u shared",
+                stats.compiled, stats.loaded, stats.shared);
+            if (ImGui::MenuItem("Clear Program Cache"))
+                Shader::clearProgramCache();
+            
+            ImGui::EndMenu();
+        }
         mScene->onImguiMenuUpdate();
         const std::string text = "TPS: %.0f | Frame Rate: %.3f s/frame (%.1f FPS)";
         ImGui::SetCursorPosX(
@@ -227,8 +301,29 @@ void Core::updateImgui()
         ImGui::RenderPlatformWindowsDefault();
         glfwMakeContextCurrent(backup_current_context);
     }
+}
+
+void Core::changeScene()
+{
+    if (mNextLevel == Level::None)
+        return;
+    
+    const bool wasRunning = mPhysicsRunning;
+    stopPhysics();
+    
+    loadScene(mNextLevel);
+    mNextLevel = Level::None;
     
-    switch (type)
+    if (wasRunning)
+        startPhysics();
+}
+
+void Core::loadScene(const Level level)
+{
+    Shader::resetProgramStats();
+    const double start = timers::getTicks<double>();
+    
+    switch (level)
     {
         case Level::None:
             break;
@@ -254,5 +349,6 @@ void Core::updateImgui()
             mScene = std::make_unique<BloomSceneDemo>();
             break;
     }
-    type = Level::None;
+    
+    mSceneLoadTime = (timers::getTicks<double>() - start) * 1000.0;
 }
@@ -11,6 +11,9 @@
 #include "glfw3.h"
 #include "imgui.h"
 
+#include <atomic>
+#include <thread>
+
 class Scene;
 
 /**
@@ -26,11 +29,31 @@ public:
     
     void run();
 protected:
+    enum class Level { None, Impulse, Octree, Platforms, Dynamic, Ode, Rotation, Bloom };
+    
     bool initGlfw();
     bool initOpenGl();
     bool initImGui();
     
     void updateImgui();
+    
+    /**
+     * @brief Swaps to the scene chosen in the menu. The physics thread is stopped while the scene changes.
+     */
+    void changeScene();
+    
+    /**
+     * @brief Makes the scene of level, timing how long it and the programs that it needs take to make.
+     */
+    void loadScene(Level level);
+    
+    void startPhysics();
+    void stopPhysics();
+    
+    /**
+     * @brief The loop of the physics thread. Runs fixed updates at the fixed time, independently of the frame rate.
+     */
+    void runPhysics();
 
 protected:
     // Order of declaration matters here.
@@ -45,6 +68,13 @@ protected:
     bool                     mIsRunning         { true };
     const unsigned int       mMaxLoopCount      { 10 };
     const bool               mEnableDebugging   { false };
+    
+    Level                    mNextLevel         { Level::None };
+    double                   mSceneLoadTime     { 0.0 };  // In milliseconds, to compare cold and warm shader caches.
+    
+    const bool               mThreadedPhysics   { true };
+    std::thread              mPhysicsThread;
+    std::atomic<bool>        mPhysicsRunning    { false };
 };
 
 
@@ -99,6 +99,16 @@ const glm::mat4 &MainCamera::getViewMatrix() const
     return mViewMatrix;
 }
 
+const glm::mat4 &MainCamera::getProjectionMatrix() const
+{
+    return mProjectionMatrix;
+}
+
+float MainCamera::getFarClip() const
+{
+    return mFarClip;
+}
+
 void MainCamera::imguiUpdate()
 {
     if (ImGui::CollapsingHeader("Camera Details"))
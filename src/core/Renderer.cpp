@@ -12,24 +12,30 @@
 #include "BoundingVolumeVisual.h"
 #include "imgui.h"
 #include "EmissivePbrGeometryShader.h"
+#include "ModelDestroyer.h"
+#include "Timers.h"
 
+#include <random>
 
-Renderer::Renderer(std::shared_ptr<MainCamera> camera, ecs::Core &EntityComponentSystem) :
+
+Renderer::Renderer(
+    std::shared_ptr<MainCamera> camera, ecs::Core &EntityComponentSystem, std::shared_ptr<TransformHierarchy> hierarchy) :
     mCamera(std::move(camera)),
+    mHierarchy(std::move(hierarchy)),
     mEcs(EntityComponentSystem),
     mGeometry(std::make_shared<FramebufferObject>(mSize, GL_ONE, GL_ZERO, GL_LESS)),
     mLightAccumulator(std::make_shared<FramebufferObject>(mSize, GL_ONE, GL_ONE, GL_ALWAYS)),
     mOutput(std::make_shared<FramebufferObject>(mSize, GL_ONE, GL_ONE, GL_ALWAYS)),
     mComposite(std::make_shared<FramebufferObject>(mSize, GL_ONE, GL_ONE, GL_ALWAYS)),
-
+    
     mPosition(std::make_shared<TextureBufferObject>(mSize, GL_RGB16F, GL_NEAREST, GL_NEAREST, 1, "Position")),
     mNormal(std::make_shared<TextureBufferObject>(mSize, GL_RGB16_SNORM, GL_NEAREST, GL_NEAREST, 1, "Normals")),
     mAlbedo(std::make_shared<TextureBufferObject>(mSize, GL_RGB16F, GL_NEAREST, GL_NEAREST, 1, "Albedo")),
     mEmissive(std::make_shared<TextureBufferObject>(mSize, GL_RGB16F, GL_NEAREST, GL_NEAREST, 1, "Emissive")),
     mDiffuse(std::make_shared<TextureBufferObject>(mSize, GL_RGB16F, GL_NEAREST, GL_NEAREST, 1, "Diffuse")),
     mSpecular(std::make_shared<TextureBufferObject>(mSize, GL_RGB16F, GL_NEAREST, GL_NEAREST, 1, "Specular")),
-    mLightTarget(std::make_shared<TextureBufferObject>(mSize, GL_RGB16F, GL_NEAREST, GL_NEAREST, 1, "Light Target")),
-
+    mLightTarget(std::make_shared<TextureBufferObject>(mSize, GL_RGBA16F, GL_NEAREST, GL_NEAREST, 1, "Light Target")),
+    
     mDownSampleTexture(std::make_shared<MipmapTexture>(mSize / 2, GL_RGB16F, mMipmapLevels, "Down Sample")),
     mUpSampleTexture(std::make_shared<MipmapTexture>(mSize, GL_RGB16F, mMipmapLevels, "Up Sample")),
     mPostProcess(std::make_shared<TextureBufferObject>(mSize, GL_RGB16, GL_NEAREST, GL_NEAREST, 1, "Post Process")),
@@ -65,18 +71,34 @@ Renderer::Renderer(std::shared_ptr<MainCamera> camera, ecs::Core &EntityComponen
     
     mComposite->attach(mPostProcess, 0);
     
-    mEcs.createSystem<BlinnPhongGeometryShader> ({ geometryTag }, mCamera, mGeometry);
-    mEcs.createSystem<EmissivePbrGeometryShader> ({ emissiveTag }, mCamera, mGeometry);
-    mEcs.createSystem<DirectionalLightShaderSystem>(mCamera, mLightAccumulator, mPosition, mNormal, mAlbedo);
-    mEcs.createSystem<PointLightShader>(mCamera, mLightAccumulator, mPosition, mNormal, mAlbedo);
+    mEcs.createSystem<BlinnPhongGeometryShader> ({ geometryTag }, mBlinnPhongBatch, mHierarchy);
+    mEcs.createSystem<GeometryBatchRenderer>    (
+        { geometryTag }, mBlinnPhongBatch, mCamera, mGeometry, mHierarchicalDepth);
+    mEcs.createSystem<EmissivePbrGeometryShader> ({ emissiveTag }, mEmissiveBatch, mHierarchy);
+    mEcs.createSystem<GeometryBatchRenderer>    (
+        { emissiveTag }, mEmissiveBatch, mCamera, mGeometry, mHierarchicalDepth);
+    mEcs.createSystem<DirectionalLightShaderSystem>(mDirectionalLighting, mFusedLighting);
+    mEcs.createSystem<PointLightShader>(mLightVolumes, mClusteredLighting, mInstancedLightVolumes);
     
     mGeometry->getFboName();
 }
 
+Renderer::~Renderer()
+{
+    destroy::mesh(mBox);
+}
+
 void Renderer::clear()
 {
+    mUniformSetsPerFrame = Shader::uniformSetCount();
+    Shader::resetUniformSetCount();
+    
+    // Bound once here, every shader that declares the Camera block reads from it for the rest of the frame.
+    mCameraUniforms.update(*mCamera);
+    
     mGeometry->clear();
-    mLightAccumulator->clear();
+    if (!mFusedLighting->isEnabled())
+        mLightAccumulator->clear();  // Never drawn to by the fused lighting.
     mOutput->clear();
     for (const auto &item : mDownSampleBuffers)
         item->clear();
@@ -94,7 +116,24 @@ void Renderer::clear()
 
 void Renderer::update()
 {
-    mDeferredLightingShader.render();
+    // Everything has been drawn to the geometry buffer by now, so next frame can cull against it.
+    mHierarchicalDepth->build(*mGeometry);
+    
+    // The light shaders have handed over their lights by now, so every lighting path is timed from the same point.
+    mLightingTimer->begin();
+    if (mFusedLighting->isEnabled())
+    {
+        mFusedLighting->render();
+    }
+    else
+    {
+        mDirectionalLighting->render();
+        mLightVolumes->render();
+        mClusteredLighting->render();
+        mInstancedLightVolumes->render();
+        mDeferredLightingShader.render();
+    }
+    mLightingTimer->end();
     
     mBloomShader.preFilter(mLightTarget.get(), mDownSampleBuffers[0].get());
     
@@ -140,6 +179,147 @@ void Renderer::imguiUpdate()
     mDownSamplingMipViewerShader.imguiUpdate(&mShow.downSampleMip);
     mUpSamplingMipViewerShader.imguiUpdate(&mShow.upSampleMip);
     mBloomShader.imGuiUpdate();
+    
+    if (ImGui::CollapsingHeader("Culling"))
+    {
+        bool isCulling = mBlinnPhongBatch->isCulling();
+        if (ImGui::Checkbox("GPU Culling", &isCulling))
+        {
+            mBlinnPhongBatch->setCulling(isCulling);
+            mEmissiveBatch->setCulling(isCulling);
+        }
+        
+        const auto showCounters = [](const char *name, const GeometryBatch &batch) {
+            const CullingCounters &counters = batch.cullingCounters();
+            ImGui::Text(
+                "%s: %u visible, %u outside the frustum, %u occluded",
+                name, counters.visible, counters.frustumCulled, counters.occlusionCulled);
+        };
+        
+        if (isCulling)
+        {
+            showCounters("Blinn-Phong", *mBlinnPhongBatch);
+            showCounters("Emissive", *mEmissiveBatch);
+        }
+    }
+    
+    if (ImGui::CollapsingHeader("Uniforms"))
+    {
+        ImGui::Text("Uniforms set per frame: %u", mUniformSetsPerFrame);
+        if (ImGui::Button("Measure"))
+            measureUniformSets();
+        
+        if (mStringSetMicroseconds > 0.0)
+        {
+            const double saved = (mStringSetMicroseconds - mHandleSetMicroseconds) * mUniformSetsPerFrame;
+            ImGui::Text("By name: %.4fus, by handle: %.4fus", mStringSetMicroseconds, mHandleSetMicroseconds);
+            ImGui::Text("Saved per frame: %.2fus", saved);
+        }
+    }
+    
+    if (ImGui::CollapsingHeader("Lighting"))
+    {
+        bool isFused = mFusedLighting->isEnabled();
+        if (ImGui::Checkbox("Fused Compute Lighting", &isFused))
+        {
+            // The fused lighting gets its point lights from the clusters.
+            mFusedLighting->setEnabled(isFused);
+            mClusteredLighting->setEnabled(isFused);
+            mInstancedLightVolumes->setEnabled(false);
+        }
+        
+        ImGui::Text("GPU time: %.3fms", mLightingTimer->milliseconds());
+        if (isFused)
+            ImGui::Text("Bandwidth saved: %.2fMB per frame", static_cast<double>(mFusedLighting->savedBytes()) / 1e6);
+    }
+    
+    if (ImGui::CollapsingHeader("Point Lights"))
+    {
+        int path = mClusteredLighting->isEnabled() ? 2 : mInstancedLightVolumes->isEnabled() ? 1 : 0;
+        if (mFusedLighting->isEnabled())
+        {
+            ImGui::Text("Clustered by the fused lighting.");
+        }
+        else
+        {
+            bool isChanged = ImGui::RadioButton("Volumes", &path, 0);
+            ImGui::SameLine();
+            isChanged |= ImGui::RadioButton("Instanced Volumes", &path, 1);
+            ImGui::SameLine();
+            isChanged |= ImGui::RadioButton("Clustered Shading", &path, 2);
+            if (isChanged)
+            {
+                mInstancedLightVolumes->setEnabled(path == 1);
+                mClusteredLighting->setEnabled(path == 2);
+            }
+        }
+        
+        if (path == 1)
+            ImGui::Text("Lights instanced: %u", mInstancedLightVolumes->lightCount());
+        if (path == 2)
+        {
+            ImGui::Text("Lights clustered: %u", mClusteredLighting->lightCount());
+            ImGui::Text(
+                "Lights dropped: %u (from %u full clusters)",
+                mClusteredLighting->droppedLights(), mClusteredLighting->fullClusters());
+            if (mClusteredLighting->droppedLights() > 0)
+            {
+                ImGui::TextWrapped(
+                    "Some clusters have more than %d lights, so the clustered image is missing lights that the "
+                    "volume paths draw. Its timings are not comparable with theirs.",
+                    ClusteredLighting::maxLightsPerCluster);
+            }
+        }
+        
+        ImGui::Text("Benchmark lights: %u", mSpawnedLights);
+        if (ImGui::Button("1k"))
+            spawnPointLights(1000);
+        ImGui::SameLine();
+        if (ImGui::Button("10k"))
+            spawnPointLights(10000);
+        ImGui::SameLine();
+        if (ImGui::Button("100k"))
+            spawnPointLights(100000);
+    }
+}
+
+void Renderer::measureUniformSets()
+{
+    constexpr int count { 10000 };
+    const glm::mat4 value(1.f);
+    
+    mBoxShader.bind();
+    const double byName = timers::measure([&]() {
+        for (int i = 0; i < count; ++i)
+            mBoxShader.set("u_model_matrix", value);
+    });
+    
+    const double byHandle = timers::measure([&]() {
+        for (int i = 0; i < count; ++i)
+            mBoxModelMatrix.set(value);
+    });
+    
+    mStringSetMicroseconds = byName * 1000.0 / count;
+    mHandleSetMicroseconds = byHandle * 1000.0 / count;
+}
+
+void Renderer::spawnPointLights(const uint32_t count)
+{
+    static std::mt19937 rng(std::chrono::steady_clock::now().time_since_epoch().count());
+    std::uniform_real_distribution<float> ground(-50.f, 50.f);
+    std::uniform_real_distribution<float> height(0.5f, 10.f);
+    std::uniform_real_distribution<float> colour(0.f, 1.f);
+    
+    for (; mSpawnedLights < count; ++mSpawnedLights)
+    {
+        light::PointLight pointLight;
+        pointLight.intensity = glm::vec3(colour(rng), colour(rng), colour(rng));
+        pointLight.distance = 3.f;
+        
+        const Entity entity = mEcs.create();
+        mEcs.add(entity, pointLight);
+        mEcs.add(entity, Position { glm::vec3(ground(rng), height(rng), ground(rng)) });
+    }
 }
 
 void Renderer::drawBox(const glm::mat4 &modelMatrix, const glm::vec3 &halfSize)
@@ -148,12 +328,10 @@ void Renderer::drawBox(const glm::mat4 &modelMatrix, const glm::vec3 &halfSize)
     mGeometry->bind();
     glBindVertexArray(mBox.renderInformation.vao);
     
-    mBoxShader.set("u_mvp", mCamera->getVpMatrix() * modelMatrix);
-    mBoxShader.set("u_model_matrix", modelMatrix);
-    mBoxShader.set("u_halfsize", halfSize);
-    mBoxShader.set("u_camera_position_ws", mCamera->getPosition());
+    mBoxModelMatrix.set(modelMatrix);
+    mBoxHalfSize.set(halfSize);
     
-    glDrawElements(GL_LINES, mBox.renderInformation.eboCount, GL_UNSIGNED_INT, 0);
+    drawElements(mBox.renderInformation, GL_LINES);
 }
 
 void Renderer::imguiMenuUpdate()
@@ -187,4 +365,17 @@ void Renderer::imguiMenuUpdate()
             mShow.upSampleMip = true;
         ImGui::EndMenu();
     }
+    
+    const uint32_t drawCount = mBlinnPhongBatch->drawCount() + mEmissiveBatch->drawCount();
+    const uint32_t commandCount = mBlinnPhongBatch->commandCount() + mEmissiveBatch->commandCount();
+    const uint32_t instanceCount = mBlinnPhongBatch->instanceCount() + mEmissiveBatch->instanceCount();
+    ImGui::Text(
+        "Geometry Draw Calls: %u (%u indirect commands, %u without instancing)",
+        drawCount, commandCount, instanceCount);
+    
+    const BindCounters &blinnPhongBinds = mBlinnPhongBatch->bindCounters();
+    const BindCounters &emissiveBinds = mEmissiveBatch->bindCounters();
+    ImGui::Text(
+        "Geometry Binds: %u (%u unsorted)",
+        blinnPhongBinds.sorted + emissiveBinds.sorted, blinnPhongBinds.unsorted + emissiveBinds.unsorted);
 }
@@ -7,75 +7,303 @@
 
 #include "Shader.h"
 #include "gtc/type_ptr.hpp"
+#include "FilePaths.h"
+#include "Timers.h"
 #include <fstream>
 #include <sstream>
+#include <iomanip>
+
+namespace
+{
+    uint32_t uniformSets { 0 };
+    ProgramStats stats;
+    bool isCompilingInParallel { false };
+    
+    /** A program and how many shaders are using it. */
+    struct SharedProgram
+    {
+        unsigned int                id          { 0 };
+        uint32_t                    users       { 0 };
+        
+        /** Set until the program is first used, as the driver may still be compiling and linking it until then. */
+        bool                        isLinking   { false };
+        std::vector<unsigned int>   stages;
+        std::filesystem::path       cachePath;
+    };
+    
+    /** Keyed by the files that a program was made from. */
+    std::unordered_map<std::string, SharedProgram> programs;
+    
+    /** The extension of every file written to the program cache. Nothing else in it is ever deleted. */
+    constexpr std::string_view cacheExtension { ".bin" };
+    
+    /** @brief Folds bytes into a 64-bit FNV-1a hash, which unlike std::hash is the same on every build and run. */
+    void fnv1a(uint64_t &hash, const std::string_view bytes)
+    {
+        for (const char byte : bytes)
+        {
+            hash ^= static_cast<unsigned char>(byte);
+            hash *= 0x100000001b3ull;
+        }
+    }
+    
+    /**
+     * @returns Where the binary of a program is cached. Named by a hash of its sources and the driver, since a binary
+     * can only be loaded by the driver that made it.
+     */
+    std::filesystem::path cachePathOf(const std::vector<std::string> &sources)
+    {
+        uint64_t hash { 0xcbf29ce484222325ull };
+        for (const GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION })
+        {
+            if (const auto *value = reinterpret_cast<const char *>(glGetString(name)))
+                fnv1a(hash, value);
+            fnv1a(hash, "\n");
+        }
+        
+        // The separators keep sources that only differ in where one ends and the next starts apart.
+        for (const std::string &source : sources)
+        {
+            fnv1a(hash, source);
+            fnv1a(hash, "\n");
+        }
+        
+        std::stringstream fileName;
+        fileName << std::hex << std::setw(16) << std::setfill('0') << hash << cacheExtension;
+        return std::filesystem::path(path::shaderCache()) / fileName.str();
+    }
+    
+    bool canCacheBinaries()
+    {
+        int formatCount { 0 };
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+        return formatCount > 0;
+    }
+}
 
 Shader::Shader(const std::filesystem::path &vertexPath, const std::filesystem::path &fragmentPath)
     : mDebugName(vertexPath.string() + " | " + fragmentPath.string())
 {
-    mId = glCreateProgram();
-    unsigned int vs = compile(GL_VERTEX_SHADER, vertexPath.string());
-    unsigned int fs = compile(GL_FRAGMENT_SHADER, fragmentPath.string());
+    create({ { GL_VERTEX_SHADER, vertexPath }, { GL_FRAGMENT_SHADER, fragmentPath } });
+}
+
+Shader::Shader(const std::filesystem::path &computePath)
+    : mDebugName(computePath.string())
+{
+    create({ { GL_COMPUTE_SHADER, computePath } });
+}
+
+Shader::~Shader()
+{
+    const auto it = programs.find(mDebugName);
+    if (it != programs.end() && --it->second.users == 0)
+    {
+        glDeleteProgram(mId);
+        programs.erase(it);
+    }
+}
+
+bool Shader::enableParallelCompile()
+{
+    // Lets the driver use as many threads as it likes.
+    if (GLEW_KHR_parallel_shader_compile)
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    else if (GLEW_ARB_parallel_shader_compile)
+        glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
     
-    glAttachShader(mId, vs);
-    glAttachShader(mId, fs);
-    glLinkProgram(mId);
-    glValidateProgram(mId);
+    isCompilingInParallel = GLEW_KHR_parallel_shader_compile || GLEW_ARB_parallel_shader_compile;
+    return isCompilingInParallel;
+}
+
+void Shader::create(const std::vector<Stage> &stages)
+{
+    stats.milliseconds += timers::measure([&]() {
+        if (const auto it = programs.find(mDebugName); it != programs.end())
+        {
+            mId = it->second.id;
+            mIsLinking = it->second.isLinking;
+            ++it->second.users;
+            ++stats.shared;
+            return;
+        }
+        
+        std::vector<std::string> sources;
+        for (const Stage &stage : stages)
+            sources.emplace_back(read(stage.path));
+        
+        mId = glCreateProgram();
+        SharedProgram &program = programs[mDebugName];
+        program.id = mId;
+        program.users = 1;
+        
+        const bool isCaching = canCacheBinaries();
+        const std::filesystem::path cachePath = isCaching ? cachePathOf(sources) : std::filesystem::path();
+        if (isCaching && loadBinary(cachePath))
+        {
+            ++stats.loaded;
+            return;
+        }
+        
+        for (std::size_t i = 0; i < stages.size(); ++i)
+        {
+            program.stages.push_back(compile(stages[i].type, sources[i]));
+            glAttachShader(mId, program.stages.back());
+        }
+        
+        glProgramParameteri(mId, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        glLinkProgram(mId);
+        
+        program.cachePath = cachePath;
+        program.isLinking = true;
+        mIsLinking = true;
+        ++stats.compiled;
+    });
     
-    glDeleteShader(vs);
-    glDeleteShader(fs);
+    // Querying the program would wait for the driver, so the rest of the renderer is made first when it can compile
+    // in the background.
+    if (!isCompilingInParallel)
+        finish();
 }
 
-Shader::~Shader()
+void Shader::finish()
 {
-    glDeleteProgram(mId);
+    mIsLinking = false;
+    
+    const auto it = programs.find(mDebugName);
+    if (it != programs.end() && it->second.isLinking)
+    {
+        SharedProgram &program = it->second;
+        stats.waitMilliseconds += timers::measure([&]() {
+            for (const unsigned int id : program.stages)
+            {
+                logCompileErrors(id);
+                glDetachShader(mId, id);
+                glDeleteShader(id);
+            }
+            
+            glValidateProgram(mId);
+            if (!program.cachePath.empty())
+                saveBinary(program.cachePath);
+        });
+        
+        program.stages.clear();
+        program.isLinking = false;
+    }
+    
+    for (std::size_t i = mLocations.size(); i < mUniformNames.size(); ++i)
+        mLocations.push_back(getLocation(mUniformNames[i]));
 }
 
-unsigned int Shader::compile(unsigned int type, std::string_view path)
+bool Shader::loadBinary(const std::filesystem::path &cachePath)
 {
-    std::ifstream file(path.data());
-    if (file.bad() || file.fail())
-        debug::log("Failed to open file at: " + std::string(path), debug::severity::Major);
+    std::ifstream file(cachePath, std::ios::binary);
+    if (!file)
+        return false;
     
-    std::stringstream buffer;
-    std::string line;
+    GLenum format { 0 };
+    file.read(reinterpret_cast<char *>(&format), sizeof(GLenum));
+    if (!file)
+        return false;
+    
+    const std::vector<char> binary((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (binary.empty())
+        return false;
+    
+    glProgramBinary(mId, format, binary.data(), static_cast<GLsizei>(binary.size()));
+    
+    // Drivers reject binaries from older versions of themselves, so this is expected after an update.
+    int result;
+    glGetProgramiv(mId, GL_LINK_STATUS, &result);
+    if (GL_TRUE != result)
+        return false;
+    
+    glValidateProgram(mId);
+    return true;
+}
+
+void Shader::saveBinary(const std::filesystem::path &cachePath)
+{
+    int result;
+    glGetProgramiv(mId, GL_LINK_STATUS, &result);
+    if (GL_TRUE != result)
+        return;
     
-    while (std::getline(file, line))
-        buffer << line << '\n';
+    int length { 0 };
+    glGetProgramiv(mId, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return;
     
-    const std::string data(buffer.str());
-    const char *dataPtr = data.c_str();
+    GLenum format { 0 };
+    std::vector<char> binary(length);
+    glGetProgramBinary(mId, length, &length, &format, binary.data());
+    
+    std::error_code error;
+    std::filesystem::create_directories(cachePath.parent_path(), error);
+    
+    std::ofstream file(cachePath, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        debug::log("Unable to cache the program binary of " + mDebugName, debug::severity::Warning);
+        return;
+    }
+    
+    file.write(reinterpret_cast<const char *>(&format), sizeof(GLenum));
+    file.write(binary.data(), length);
+}
+
+std::string Shader::read(const std::filesystem::path &path)
+{
+    std::ifstream file(path);
+    if (file.bad() || file.fail())
+        debug::log("Failed to open file at: " + path.string(), debug::severity::Major);
+    
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+unsigned int Shader::compile(unsigned int type, const std::string &source)
+{
+    const char *dataPtr = source.c_str();
     
     unsigned int id = glCreateShader(type);
     glShaderSource(id, 1, &dataPtr, nullptr);
     glCompileShader(id);
-    
+    return id;
+}
+
+void Shader::logCompileErrors(unsigned int id)
+{
     int result;
     glGetShaderiv(id, GL_COMPILE_STATUS, &result);  // OpenGL fails silently, so we need to check it ourselves.
     if (GL_TRUE == result)
-        return id;
+        return;
     
-    const std::unordered_map<unsigned int, std::string> shaderTypes {
+    const std::unordered_map<int, std::string> shaderTypes {
         { GL_VERTEX_SHADER, "Vertex" },
         { GL_FRAGMENT_SHADER, "Fragment" },
         { GL_GEOMETRY_SHADER, "Geometry" },
-        { GL_COMPUTE_SHADER, "Fragment" },
+        { GL_COMPUTE_SHADER, "Compute" },
     };
     
+    int type;
+    glGetShaderiv(id, GL_SHADER_TYPE, &type);
+    
     // Failed to compile shader.
     int length;
     glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length);
     char *message = (char*)alloca(length * sizeof(char));  // No point doing a heap allocation.
     glGetShaderInfoLog(id, length, &length, message);
-    glDeleteShader(id);
     
     debug::log("Failed to compile " + shaderTypes.at(type) + " shader:\n" + message,
                debug::severity::Major);
-    return 0;
 }
 
-void Shader::bind() const
+void Shader::bind()
 {
+    if (mIsLinking)
+        finish();
+    
     glUseProgram(mId);
 }
 
@@ -86,6 +314,9 @@ void Shader::unbind()
 
 int Shader::getLocation(const std::string &name)
 {
+    if (mIsLinking)
+        finish();
+    
     if (mCache.count(name) > 0)
         return mCache.at(name);
     
@@ -132,3 +363,101 @@ void Shader::set(const std::string &uniformName, const int textureId, const int
     glBindTextureUnit(bindPoint, textureId);
     set(uniformName, bindPoint);
 }
+
+uint32_t Shader::uniformSetCount()
+{
+    return uniformSets;
+}
+
+void Shader::resetUniformSetCount()
+{
+    uniformSets = 0;
+}
+
+std::size_t Shader::addUniform(const std::string &name)
+{
+    mUniformNames.push_back(name);
+    if (!mIsLinking)
+        mLocations.push_back(getLocation(name));
+    
+    return mUniformNames.size() - 1;
+}
+
+int Shader::location(const std::size_t index)
+{
+    if (mIsLinking)
+        finish();
+    
+    return mLocations[index];
+}
+
+const ProgramStats &Shader::programStats()
+{
+    return stats;
+}
+
+void Shader::resetProgramStats()
+{
+    stats = ProgramStats();
+}
+
+void Shader::clearProgramCache()
+{
+    // The cache path can be configured, so only the files that the cache could have written are deleted.
+    std::error_code error;
+    for (const auto &entry : std::filesystem::directory_iterator(path::shaderCache(), error))
+    {
+        if (entry.is_regular_file(error) && entry.path().extension() == cacheExtension)
+            std::filesystem::remove(entry.path(), error);
+    }
+}
+
+template<>
+void Shader::Uniform<int>::set(const int &value) const
+{
+    glProgramUniform1i(mShader->mId, mShader->location(mIndex), value);
+    ++uniformSets;
+}
+
+template<>
+void Shader::Uniform<float>::set(const float &value) const
+{
+    glProgramUniform1f(mShader->mId, mShader->location(mIndex), value);
+    ++uniformSets;
+}
+
+template<>
+void Shader::Uniform<glm::mat4>::set(const glm::mat4 &value) const
+{
+    glProgramUniformMatrix4fv(mShader->mId, mShader->location(mIndex), 1, GL_FALSE, glm::value_ptr(value));
+    ++uniformSets;
+}
+
+template<>
+void Shader::Uniform<glm::vec4>::set(const glm::vec4 &value) const
+{
+    glProgramUniform4fv(mShader->mId, mShader->location(mIndex), 1, glm::value_ptr(value));
+    ++uniformSets;
+}
+
+template<>
+void Shader::Uniform<glm::vec3>::set(const glm::vec3 &value) const
+{
+    glProgramUniform3fv(mShader->mId, mShader->location(mIndex), 1, glm::value_ptr(value));
+    ++uniformSets;
+}
+
+template<>
+void Shader::Uniform<glm::vec2>::set(const glm::vec2 &value) const
+{
+    glProgramUniform2fv(mShader->mId, mShader->location(mIndex), 1, glm::value_ptr(value));
+    ++uniformSets;
+}
+
+template<>
+void Shader::Uniform<TextureUnit>::set(const TextureUnit &value) const
+{
+    glBindTextureUnit(value.bindPoint, value.textureId);
+    glProgramUniform1i(mShader->mId, mShader->location(mIndex), value.bindPoint);
+    ++uniformSets;
+}
@@ -14,11 +14,10 @@
 BloomSceneDemo::BloomSceneDemo()
 {
     mBanana = createModel(glm::vec3(-0.8f, 0.4f, -0.8f), mBananaModel);
-    auto &bananaTransform = mEcs.getComponent<Transform>(mBanana);
-    bananaTransform.scale = glm::vec3(0.5f);
-    bananaTransform.rotation = glm::quat(0.356f, -0.486f, 0.798f, -0.005f);
+    mEcs.getComponent<Scale>(mBanana).value = glm::vec3(0.5f);
+    mEcs.getComponent<Rotation>(mBanana).value = glm::quat(0.356f, -0.486f, 0.798f, -0.005f);
     
-    createModel(glm::vec3(0.f, 0.f, 0.f), mJapanModel);
+    makeStatic(createModel(glm::vec3(0.f, 0.f, 0.f), mJapanModel));
     
     mPointLight = mEcs.create();
     mEcs.add(mPointLight, light::PointLight());
@@ -45,10 +44,12 @@ void BloomSceneDemo::onImguiUpdate()
     }
     if (ImGui::CollapsingHeader("Banana"))
     {
-        auto &transform = mEcs.getComponent<Transform>(mBanana);
-        ImGui::DragFloat3("Position", glm::value_ptr(transform.position), 0.1f);
-        ImGui::DragFloat4("Rotation", glm::value_ptr(transform.rotation), 0.1f);
-        transform.rotation = glm::normalize(transform.rotation);
-        ImGui::DragFloat3("Scale", glm::value_ptr(transform.scale), 0.1f);
+        auto &position = mEcs.getComponent<Position>(mBanana);
+        auto &rotation = mEcs.getComponent<Rotation>(mBanana);
+        auto &scale = mEcs.getComponent<Scale>(mBanana);
+        ImGui::DragFloat3("Position", glm::value_ptr(position.value), 0.1f);
+        ImGui::DragFloat4("Rotation", glm::value_ptr(rotation.value), 0.1f);
+        rotation.value = glm::normalize(rotation.value);
+        ImGui::DragFloat3("Scale", glm::value_ptr(scale.value), 0.1f);
     }
 }
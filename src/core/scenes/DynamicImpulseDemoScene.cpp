@@ -57,11 +57,15 @@ void DynamicImpulseDemoScene::onImguiUpdate()
 {
     if (ImGui::Button("Start Physics") && !mSetup)
     {
-        mEcs.createSystem<TreeBuilder>(mTree);
-        mEcs.createSystem<CollisionDetection>(mRenderer, mTree);
-        mEcs.createSystem<LinearEulerMethod>();
-        mEcs.createSystem<LinearKinematicSystem>();
-        mEcs.createSystem<AngularEulerMethod>();
+        mEcs.createSystem<TreeBuilder>(mTree, mHierarchy);
+        mEcs.createSystem<CollisionDetection>(mTree, mHierarchy);
+        createSchedulerDispatch();
+        mFixedScheduler->add<DynamicObject, Velocity, Position>("Linear Euler", LinearEulerMethod::integrate);
+        mFixedScheduler->add<const Kinematic, const Velocity, Position>("Linear Kinematic", LinearKinematicSystem::integrate);
+        mFixedScheduler->add<Torque, AngularObject, AngularVelocity, Rotation>("Angular Quaternion", [](
+            Torque &torque, AngularObject &angularObject, AngularVelocity &angularVelocity, Rotation &rotation) {
+            AngularQuaternionMethod::integrate(torque, angularObject, angularVelocity, rotation.value, false);
+        });
         mSetup = true;
     }
     
@@ -78,15 +82,17 @@ void DynamicImpulseDemoScene::onImguiUpdate()
 
 void DynamicImpulseDemoScene::showBallSettings(Entity entity)
 {
-    auto &transform = mEcs.getComponent<Transform>(entity);
+    auto &position = mEcs.getComponent<Position>(entity);
+    auto &rotation = mEcs.getComponent<Rotation>(entity);
+    auto &scale = mEcs.getComponent<Scale>(entity);
     auto &dynamicObject = mEcs.getComponent<DynamicObject>(entity);
     auto &physicsMaterial = mEcs.getComponent<PhysicsMaterial>(entity);
     
     std::string hash = std::to_string(entity);
     
-    ImGui::DragFloat3(std::string("Position##" + hash).c_str(),     glm::value_ptr(transform.position), 0.1f);
-    ImGui::DragFloat4(std::string("Rotation##" + hash).c_str(),     glm::value_ptr(transform.rotation), 0.1f);
-    ImGui::DragFloat3(std::string("Scale##" + hash).c_str(),        glm::value_ptr(transform.scale), 0.1f);
+    ImGui::DragFloat3(std::string("Position##" + hash).c_str(),     glm::value_ptr(position.value), 0.1f);
+    ImGui::DragFloat4(std::string("Rotation##" + hash).c_str(),     glm::value_ptr(rotation.value), 0.1f);
+    ImGui::DragFloat3(std::string("Scale##" + hash).c_str(),        glm::value_ptr(scale.value), 0.1f);
     ImGui::DragFloat3(std::string("Force##" + hash).c_str(),        glm::value_ptr(dynamicObject.force), 0.1f);
     ImGui::DragFloat( std::string("Mass##" + hash).c_str(),         &dynamicObject.mass);
     ImGui::DragFloat3(std::string("Momentum##" + hash).c_str(),     glm::value_ptr(dynamicObject.momentum), 0.1f);
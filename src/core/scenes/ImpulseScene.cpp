@@ -13,6 +13,7 @@
 #include "TreeBuilder.h"
 #include "CollisionDetection.h"
 #include "ModelDestroyer.h"
+#include "ConvexHullLoader.h"
 #include "imgui.h"
 #include "gtc/type_ptr.hpp"
 
@@ -35,11 +36,18 @@ ImpulseScene::ImpulseScene()
     mCollisionResponse.makeBoundingSphere(mYellowBall, true, 1.f);
     
     Entity floor = createModel(glm::vec3(0.f), mFloor);
+    makeStatic(floor);
     std::shared_ptr<BoundingVolume> floorHitBox = std::make_shared<BoundingBox>(floor, glm::vec3(50.f, 0.1f, 50.f));
     mEcs.add(floor, Velocity { glm::vec3(0.f, 0.0f, 0.f) });
     mEcs.add(floor, floorHitBox);
     mEcs.add(floor, Kinematic());
     
+    // The teapot sits under the green and blue balls, using a hull instead of a box for its shape.
+    Entity teapot = createModel(glm::vec3(0.f, 0.1f, 0.f), mTeapot);
+    makeStatic(teapot);
+    mEcs.add(teapot, Kinematic());
+    mCollisionResponse.makeConvexHull(teapot, load::convexHull(path::resources() + "models/UtahTeapot.obj"), false);
+    
     Entity sun = mEcs.create();
     mEcs.add(sun, light::DirectionalLight());
 }
@@ -50,6 +58,7 @@ ImpulseScene::~ImpulseScene()
     destroy::model(mGreenSphere);
     destroy::model(mBlueSphere);
     destroy::model(mYellowSphere);
+    destroy::model(mTeapot);
     destroy::model(mFloor);
 }
 
@@ -62,12 +71,16 @@ void ImpulseScene::onImguiUpdate()
 {
     if (ImGui::Button("Start Physics") && !mSetup)
     {
-        mEcs.createSystem<Gravity>();
-        mEcs.createSystem<TreeBuilder>(mTree);
-        mEcs.createSystem<CollisionDetection>(mRenderer, mTree);
-        mEcs.createSystem<LinearEulerMethod>();
-        mEcs.createSystem<LinearKinematicSystem>();
-        mEcs.createSystem<AngularEulerMethod>();
+        mEcs.createSystem<TreeBuilder>(mTree, mHierarchy);
+        mEcs.createSystem<CollisionDetection>(mTree, mHierarchy);
+        createSchedulerDispatch();
+        mFixedScheduler->add<DynamicObject>("Gravity", Gravity::apply);
+        mFixedScheduler->add<DynamicObject, Velocity, Position>("Linear Euler", LinearEulerMethod::integrate);
+        mFixedScheduler->add<const Kinematic, const Velocity, Position>("Linear Kinematic", LinearKinematicSystem::integrate);
+        mFixedScheduler->add<Torque, AngularObject, AngularVelocity, Rotation>("Angular Quaternion", [](
+            Torque &torque, AngularObject &angularObject, AngularVelocity &angularVelocity, Rotation &rotation) {
+            AngularQuaternionMethod::integrate(torque, angularObject, angularVelocity, rotation.value, false);
+        });
         mSetup = true;
     }
     
@@ -116,15 +129,17 @@ void ImpulseScene::onRender()
 
 void ImpulseScene::showSettings(Entity entity)
 {
-    auto &transform = mEcs.getComponent<Transform>(entity);
+    auto &position = mEcs.getComponent<Position>(entity);
+    auto &rotation = mEcs.getComponent<Rotation>(entity);
+    auto &scale = mEcs.getComponent<Scale>(entity);
     auto &dynamicObject = mEcs.getComponent<DynamicObject>(entity);
     auto &physicsMaterial = mEcs.getComponent<PhysicsMaterial>(entity);
     
     std::string hash = std::to_string(entity);
     
-    ImGui::DragFloat3(std::string("Position##" + hash).c_str(),     glm::value_ptr(transform.position), 0.1f);
-    ImGui::DragFloat4(std::string("Rotation##" + hash).c_str(),     glm::value_ptr(transform.rotation), 0.1f);
-    ImGui::DragFloat3(std::string("Scale##" + hash).c_str(),        glm::value_ptr(transform.scale), 0.1f);
+    ImGui::DragFloat3(std::string("Position##" + hash).c_str(),     glm::value_ptr(position.value), 0.1f);
+    ImGui::DragFloat4(std::string("Rotation##" + hash).c_str(),     glm::value_ptr(rotation.value), 0.1f);
+    ImGui::DragFloat3(std::string("Scale##" + hash).c_str(),        glm::value_ptr(scale.value), 0.1f);
     ImGui::DragFloat3(std::string("Force##" + hash).c_str(),        glm::value_ptr(dynamicObject.force), 0.1f);
     ImGui::DragFloat( std::string("Mass##" + hash).c_str(),         &dynamicObject.mass);
     ImGui::DragFloat3(std::string("Momentum##" + hash).c_str(),     glm::value_ptr(dynamicObject.momentum), 0.1f);
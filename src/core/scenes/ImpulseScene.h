@@ -58,6 +58,10 @@ protected:
         load::model<PhongVertex, BlinnPhongMaterial>(
             path::resources() + "models/physics/YellowSphere.obj") };
     
+    Model<PhongVertex, BlinnPhongMaterial> mTeapot {
+        load::model<PhongVertex, BlinnPhongMaterial>(
+            path::resources() + "models/UtahTeapot.obj") };
+    
     Model<PhongVertex, BlinnPhongMaterial> mFloor {
         load::model<PhongVertex, BlinnPhongMaterial>(
             path::resources() + "models/thick-floor/ThickFloor.obj") };
@@ -11,6 +11,7 @@
 #include "LightingComponents.h"
 #include "PhysicsSystems.h"
 #include "TreeBuilder.h"
+#include "ModelSpawner.h"
 #include "CollisionDetection.h"
 #include "ModelDestroyer.h"
 #include "imgui.h"
@@ -20,15 +21,19 @@
 
 OctreeDemoScene::OctreeDemoScene()
 {
+    std::vector<Transform> transforms;
     for (int i = 0; i < 40; ++i)
+        transforms.push_back({ glm::vec3(randomValue(), randomValue(), randomValue()) });
+    
+    const std::vector<Entity> crates = createModels(transforms, mCrate);
+    for (std::size_t i = 0; i < crates.size(); ++i)
     {
-        glm::vec3 position = glm::vec3(randomValue(), randomValue(), randomValue());
-        Entity crate = createModel(position, mCrate);
-        mCollisionResponse.makeBoundingBox(crate, false);
-        mEcs.add(crate, Rotator { randomValue(), randomValue(), position });
+        mCollisionResponse.makeBoundingBox(crates[i], false);
+        mEcs.add(crates[i], Rotator { randomValue(), randomValue(), transforms[i].position });
     }
     
     Entity floor = createModel(glm::vec3(0.f), mFloor);
+    makeStatic(floor);
     std::shared_ptr<BoundingVolume> floorHitBox = std::make_shared<BoundingBox>(floor, glm::vec3(50.f, 0.1f, 50.f));
     mEcs.add(floor, Velocity { glm::vec3(0.f, 0.0f, 0.f) });
     mEcs.add(floor, floorHitBox);
@@ -37,8 +42,9 @@ OctreeDemoScene::OctreeDemoScene()
     Entity sun = mEcs.create();
     mEcs.add(sun, light::DirectionalLight());
     
-    mEcs.createSystem<TreeBuilder>(mTree);
-    mEcs.createSystem<CollisionDetection>(mRenderer, mTree);
+    mEcs.createSystem<TreeBuilder>(mTree, mHierarchy);
+    mEcs.createSystem<CollisionDetection>(mTree, mHierarchy);
+    createSchedulerDispatch();
 }
 
 OctreeDemoScene::~OctreeDemoScene()
@@ -82,6 +88,41 @@ void OctreeDemoScene::onImguiUpdate()
             ImGui::EndTooltip();
         }
     }
+    if (ImGui::CollapsingHeader("Spawning"))
+    {
+        ImGui::TextWrapped("Spawns crates into an empty ecs one at a time with createModel() and then all at once "
+                           "with createModels().");
+        if (ImGui::Button("Run Spawn Benchmark"))
+        {
+            mSpawnBenchmarks.clear();
+            for (const uint32_t modelCount : { 1'000u, 10'000u, 100'000u })
+                mSpawnBenchmarks.push_back(benchmarkModelSpawn(modelCount));
+        }
+        
+        if (!mSpawnBenchmarks.empty() && ImGui::BeginTable("Spawn Benchmarks", 4))
+        {
+            ImGui::TableSetupColumn("Models");
+            ImGui::TableSetupColumn("One at a Time");
+            ImGui::TableSetupColumn("All at Once");
+            ImGui::TableSetupColumn("Speed Up");
+            ImGui::TableHeadersRow();
+            for (const auto &[modelCount, singleModelsPerMs, bulkModelsPerMs] : mSpawnBenchmarks)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", modelCount);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.0f", singleModelsPerMs);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.0f", bulkModelsPerMs);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2fx", singleModelsPerMs > 0.0 ? bulkModelsPerMs / singleModelsPerMs : 0.0);
+            }
+            ImGui::EndTable();
+            ImGui::TextDisabled("Models spawned per millisecond.");
+        }
+    }
+    
     ImGui::TextWrapped("The Octree will update based on the bounding boxes of each item. Open Octree Debugging to "
                        "enable boundary drawing. You can also reset the scene in the navbar under scenes.");
     ImGui::TextWrapped("Note that collision detection is still happening between items but no responses have been"
@@ -11,6 +11,7 @@
 #include "Ecs.h"
 #include "Scene.h"
 #include "Tree.h"
+#include "ModelSpawner.h"
 
 /**
  * @author Ryan Purse
@@ -34,6 +35,8 @@ protected:
     bool mShowBounds        { false };
     bool mShowElementBounds { false };
     
+    std::vector<ModelSpawnBenchmark> mSpawnBenchmarks;
+    
     Model<PhongVertex, BlinnPhongMaterial> mCrate {
         load::model<PhongVertex, BlinnPhongMaterial>(
             path::resources() + "models/physics/Crate2.obj") };
@@ -23,8 +23,14 @@ OdeDemoScene::OdeDemoScene()
     setupBall(mBlueBall,    mRk4Tag,    glm::vec3( 2.f, 5.f, 0.f), mBlueSphere);
     setupBall(mYellowBall,  mRkNTag,    glm::vec3( 6.f, 5.f, 0.f), mYellowSphere);
     
+    // A stiff spring that the fixed tick cannot resolve on its own, so the adaptive integrator has to substep.
+    setupBall(mSpringBall,  mAdaptiveTag, glm::vec3(10.f, 5.f, 0.f), mWhiteSphere);
+    mEcs.add(mSpringBall, Spring { glm::vec3(10.f, 8.f, 0.f), 2.f, 2e5f, 50.f });
+    mEcs.add(mSpringBall, AdaptiveStep());
+    
     
     Entity floor = createModel(glm::vec3(0.f), mFloor);
+    makeStatic(floor);
     std::shared_ptr<BoundingVolume> floorHitBox = std::make_shared<BoundingBox>(floor, glm::vec3(50.f, 0.1f, 50.f));
     mEcs.add(floor, Velocity { glm::vec3(0.f, 0.0f, 0.f) });
     mEcs.add(floor, floorHitBox);
@@ -40,6 +46,7 @@ OdeDemoScene::~OdeDemoScene()
     destroy::model(mGreenSphere);
     destroy::model(mBlueSphere);
     destroy::model(mYellowSphere);
+    destroy::model(mWhiteSphere);
     destroy::model(mFloor);
 }
 
@@ -62,20 +69,41 @@ void OdeDemoScene::onImguiUpdate()
 {
     if (ImGui::Button("Start Physics") && !mSetup)
     {
-        mEcs.createSystem<TreeBuilder>(mTree);
-        mEcs.createSystem<CollisionDetection>(mRenderer, mTree);
+        mEcs.createSystem<TreeBuilder>(mTree, mHierarchy);
+        mEcs.createSystem<CollisionDetection>(mTree, mHierarchy);
         
-        mEcs.createSystem<Gravity>({ mEulerTag });
-        mEcs.createSystem<LinearEulerMethod>({ mEulerTag });
-    
-        mEcs.createSystem<Gravity>({ mRk2Tag });
-        mEcs.createSystem<LinearRk2>({ mRk2Tag });
-    
-        mEcs.createSystem<Gravity>({ mRk4Tag });
-        mEcs.createSystem<LinearRk4>({ mRk4Tag });
-    
-        mEcs.createSystem<Gravity>({ mRkNTag });
-        mEcs.createSystem<LinearRk>({ mRkNTag }, mRkNValue);
+        // Gravity and the per-entity integrators of each tag touch different entities, so each wave runs them
+        // together. The batch, RkN and adaptive integrators are created after the dispatch so they see gravity.
+        createSchedulerDispatch();
+        mFixedScheduler->add<DynamicObject>("Euler Gravity", Gravity::apply, { mEulerTag });
+        mFixedScheduler->add<DynamicObject>("Rk2 Gravity", Gravity::apply, { mRk2Tag });
+        mFixedScheduler->add<DynamicObject>("Rk4 Gravity", Gravity::apply, { mRk4Tag });
+        mFixedScheduler->add<DynamicObject>("RkN Gravity", Gravity::apply, { mRkNTag });
+        mFixedScheduler->add<DynamicObject>("Adaptive Gravity", Gravity::apply, { mAdaptiveTag });
+        
+        if (mBatchIntegration)
+        {
+            auto eulerBatch = std::make_shared<LinearBatch>();
+            mEcs.createSystem<LinearBatchGather>({ mEulerTag }, eulerBatch);
+            mEcs.createSystem<LinearBatchEuler>({ mEulerTag }, eulerBatch);
+            
+            auto rk2Batch = std::make_shared<LinearBatch>();
+            mEcs.createSystem<LinearBatchGather>({ mRk2Tag }, rk2Batch);
+            mEcs.createSystem<LinearBatchRk2>({ mRk2Tag }, rk2Batch);
+            
+            auto rk4Batch = std::make_shared<LinearBatch>();
+            mEcs.createSystem<LinearBatchGather>({ mRk4Tag }, rk4Batch);
+            mEcs.createSystem<LinearBatchRk4>({ mRk4Tag }, rk4Batch);
+        }
+        else
+        {
+            mFixedScheduler->add<DynamicObject, Velocity, Position>("Euler", LinearEulerMethod::integrate, { mEulerTag });
+            mFixedScheduler->add<DynamicObject, Velocity, Position>("Rk2", LinearRk2::integrate, { mRk2Tag });
+            mFixedScheduler->add<DynamicObject, Velocity, Position>("Rk4", LinearRk4::integrate, { mRk4Tag });
+        }
+        
+        mEcs.createSystem<LinearRkN>({ mRkNTag }, mRkNValue);
+        mEcs.createSystem<LinearDormandPrince>({ mAdaptiveTag });
         
         mSetup = true;
     }
@@ -100,10 +128,128 @@ void OdeDemoScene::onImguiUpdate()
         }
     }
     
+    if (ImGui::CollapsingHeader("Batch Integration"))
+    {
+        ImGui::Checkbox("Batch Integration", &mBatchIntegration);
+        ImGui::SameLine();
+        ImGui::TextDisabled("(?)");
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::BeginTooltip();
+            ImGui::PushTextWrapPos(ImGui::GetFontSize() * 35.0f);
+            ImGui::TextUnformatted("The red, green and blue spheres use the structure of arrays integrators. The RkN and "
+                                   "adaptive spheres stay per entity. Must be set before the physics is started.");
+            ImGui::PopTextWrapPos();
+            ImGui::EndTooltip();
+        }
+        
+        if (ImGui::Button("Run Benchmark"))
+        {
+            mBenchmarks.clear();
+            for (const uint32_t bodyCount : { 1'000u, 10'000u, 100'000u, 1'000'000u })
+                mBenchmarks.push_back(physics::benchmarkLinearBatch(bodyCount));
+        }
+        
+        if (!mBenchmarks.empty() && ImGui::BeginTable("Benchmarks", 4))
+        {
+            ImGui::TableSetupColumn("Bodies");
+            ImGui::TableSetupColumn("Per Entity");
+            ImGui::TableSetupColumn("Batch");
+            ImGui::TableSetupColumn("Batch SIMD");
+            ImGui::TableHeadersRow();
+            for (const auto &[bodyCount, perEntity, scalarBatch, simdBatch] : mBenchmarks)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", bodyCount);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.0f", perEntity);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.0f", scalarBatch);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.0f", simdBatch);
+            }
+            ImGui::EndTable();
+            ImGui::TextDisabled("Bodies integrated per millisecond.");
+        }
+    }
+    
+    if (ImGui::CollapsingHeader("Runge-Kutta Benchmark"))
+    {
+        ImGui::TextWrapped("Compares the compile time Rk4 tableau against the runtime RkN method of the same order.");
+        if (ImGui::Button("Run Rk Benchmark"))
+        {
+            mRungeKuttaBenchmarks.clear();
+            for (const uint32_t bodyCount : { 4u, 1'000u, 100'000u })
+                mRungeKuttaBenchmarks.push_back(physics::benchmarkRungeKutta(bodyCount));
+        }
+        
+        if (!mRungeKuttaBenchmarks.empty() && ImGui::BeginTable("Rk Benchmarks", 3))
+        {
+            ImGui::TableSetupColumn("Bodies");
+            ImGui::TableSetupColumn("LinearRk4");
+            ImGui::TableSetupColumn("LinearRkN(4)");
+            ImGui::TableHeadersRow();
+            for (const auto &[bodyCount, templated, runtime] : mRungeKuttaBenchmarks)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", bodyCount);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.0f", templated);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.0f", runtime);
+            }
+            ImGui::EndTable();
+            ImGui::TextDisabled("Bodies integrated per millisecond.");
+        }
+    }
+    
+    if (ImGui::CollapsingHeader("Snapshot Benchmark"))
+    {
+        ImGui::TextWrapped("Times capturing and restoring every physics component, then checks that a recorded run replays bit for bit.");
+        if (ImGui::Button("Run Snapshot Benchmark"))
+        {
+            mSnapshotBenchmarks.clear();
+            for (const uint32_t bodyCount : { 1'000u, 10'000u, 100'000u })
+                mSnapshotBenchmarks.push_back(physics::benchmarkSnapshot(bodyCount));
+        }
+        
+        if (!mSnapshotBenchmarks.empty() && ImGui::BeginTable("Snapshot Benchmarks", 5))
+        {
+            ImGui::TableSetupColumn("Bodies");
+            ImGui::TableSetupColumn("Bytes");
+            ImGui::TableSetupColumn("Capture (ms)");
+            ImGui::TableSetupColumn("Restore (ms)");
+            ImGui::TableSetupColumn("Replay");
+            ImGui::TableHeadersRow();
+            for (const auto &[bodyCount, bytes, captureMs, restoreMs, replayMatches] : mSnapshotBenchmarks)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", bodyCount);
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", bytes);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", captureMs);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", restoreMs);
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(replayMatches ? "Exact" : "Diverged");
+            }
+            ImGui::EndTable();
+        }
+    }
+    
     ImGui::TextWrapped("Red Sphere    - Euler's Method");
     ImGui::TextWrapped("Green Sphere  - Rk2 Method");
     ImGui::TextWrapped("Blue Sphere   - Rk4 Method");
     ImGui::TextWrapped("Yellow Sphere - RkN Method");
+    ImGui::TextWrapped("White Sphere  - Adaptive Dormand-Prince on a stiff spring");
+    
+    auto &adaptiveStep = mEcs.getComponent<AdaptiveStep>(mSpringBall);
+    ImGui::DragFloat("Tolerance", &adaptiveStep.tolerance, 1e-6f, 1e-7f, 1e-1f, "%.7f");
+    ImGui::Text("Accepted: %u, Rejected: %u, Step: %.5fs", adaptiveStep.acceptedSteps, adaptiveStep.rejectedSteps, adaptiveStep.step);
     
     const uint32_t min = 1;
     ImGui::DragScalar("RkN Order", ImGuiDataType_U32, &mRkNValue, 1.f, &min);
@@ -120,7 +266,7 @@ void OdeDemoScene::onImguiUpdate()
 }
 
 void OdeDemoScene::setupBall(
-    Entity ball, Component type, const glm::vec3 position,
+    Entity &ball, Component type, const glm::vec3 position,
     Model<PhongVertex, BlinnPhongMaterial> &model)
 {
     // We can't use collision response factories as they set up components using the default channels.
@@ -11,6 +11,8 @@
 #include "Ecs.h"
 #include "Scene.h"
 #include "Tree.h"
+#include "PhysicsSystems.h"
+#include "PhysicsSnapshot.h"
 
 /**
  * @author Ryan Purse
@@ -28,20 +30,27 @@ public:
     void onImguiUpdate() override;
     
 protected:
-    void setupBall(Entity ball, Component type, const glm::vec3 position, Model<PhongVertex, BlinnPhongMaterial> &model);
+    void setupBall(Entity &ball, Component type, const glm::vec3 position, Model<PhongVertex, BlinnPhongMaterial> &model);
     
     Component mEulerTag { mEcs.create<DynamicObject>() };
     Component mRk2Tag   { mEcs.create<DynamicObject>() };
     Component mRk4Tag   { mEcs.create<DynamicObject>() };
     Component mRkNTag   { mEcs.create<DynamicObject>() };
+    Component mAdaptiveTag { mEcs.create<DynamicObject>() };
     
     Entity mRedBall;
     Entity mGreenBall;
     Entity mBlueBall;
     Entity mYellowBall;
+    Entity mSpringBall;
     
     uint32_t mRkNValue { 4 };
     
+    bool mBatchIntegration { false };
+    std::vector<physics::LinearBatchBenchmark> mBenchmarks;
+    std::vector<physics::RungeKuttaBenchmark> mRungeKuttaBenchmarks;
+    std::vector<physics::SnapshotBenchmark> mSnapshotBenchmarks;
+    
     std::shared_ptr<octree::Tree<CollisionEntity>> mTree {
         std::make_shared<octree::Tree<CollisionEntity>>(octree::AABB { glm::vec3(0.f), glm::vec3(52.f) }, 2) };
     
@@ -65,6 +74,10 @@ protected:
         load::model<PhongVertex, BlinnPhongMaterial>(
             path::resources() + "models/physics/YellowSphere.obj") };
     
+    Model<PhongVertex, BlinnPhongMaterial> mWhiteSphere {
+        load::model<PhongVertex, BlinnPhongMaterial>(
+            path::resources() + "models/physics/Sphere.obj") };
+    
     Model<PhongVertex, BlinnPhongMaterial> mFloor {
         load::model<PhongVertex, BlinnPhongMaterial>(
             path::resources() + "models/thick-floor/ThickFloor.obj") };
@@ -24,17 +24,16 @@ PlatformDemoScene::PlatformDemoScene()
     
     mRamp = createModel(glm::vec3(-10.2f, 7.8f, 0.f), mFloor);
     mCollisionResponse.makeBoundingBox(mRamp, false, glm::vec3(10.f, 0.1f, 10.f));
-    mEcs.getComponent<Transform>(mRamp).rotation = glm::quat(0.85f, 0.242f, 0.455f, -0.106f);
+    mEcs.getComponent<Rotation>(mRamp).value = glm::quat(0.85f, 0.242f, 0.455f, -0.106f);
     
     mGround = createModel(glm::vec3(-0.4f, 0.2f, 15.1f), mFloor);
     mCollisionResponse.makeBoundingBox(mGround, false, glm::vec3(10.f, 0.1f, 10.f));
-    mEcs.getComponent<Transform>(mGround).rotation = glm::quat(0.936f, 0.f, 0.353f, 0.f);
+    mEcs.getComponent<Rotation>(mGround).value = glm::quat(0.936f, 0.f, 0.353f, 0.f);
     
     mCrate = createModel(glm::vec3(8.6f, 2.5f, 18.4f), mCrateModel);
     mCollisionResponse.makeBoundingBox(mCrate, false, glm::vec3(1.f, 1.f, 1.f));
-    auto &crateTransform = mEcs.getComponent<Transform>(mCrate);
-    crateTransform.rotation = glm::quat(0.406f, 0.f, 0.914f, 0.f);
-    crateTransform.scale = glm::vec3(1.f, 2.f, 10.f);
+    mEcs.getComponent<Rotation>(mCrate).value = glm::quat(0.406f, 0.f, 0.914f, 0.f);
+    mEcs.getComponent<Scale>(mCrate).value = glm::vec3(1.f, 2.f, 10.f);
     
     Entity sun = mEcs.create();
     mEcs.add(sun, light::DirectionalLight());
@@ -66,27 +65,33 @@ void PlatformDemoScene::onImguiUpdate()
 {
     if (ImGui::Button("Start Physics") && !mSetup)
     {
-        mEcs.createSystem<Gravity>();
-        mEcs.createSystem<TreeBuilder>(mTree);
-        mEcs.createSystem<CollisionDetection>(mRenderer, mTree);
-        mEcs.createSystem<LinearEulerMethod>();
-        mEcs.createSystem<LinearKinematicSystem>();
-        mEcs.createSystem<AngularEulerMethod>();
+        mEcs.createSystem<TreeBuilder>(mTree, mHierarchy);
+        mEcs.createSystem<CollisionDetection>(mTree, mHierarchy);
+        createSchedulerDispatch();
+        mFixedScheduler->add<DynamicObject>("Gravity", Gravity::apply);
+        mFixedScheduler->add<DynamicObject, Velocity, Position>("Linear Euler", LinearEulerMethod::integrate);
+        mFixedScheduler->add<const Kinematic, const Velocity, Position>("Linear Kinematic", LinearKinematicSystem::integrate);
+        mFixedScheduler->add<Torque, AngularObject, AngularVelocity, Rotation>("Angular Quaternion", [](
+            Torque &torque, AngularObject &angularObject, AngularVelocity &angularVelocity, Rotation &rotation) {
+            AngularQuaternionMethod::integrate(torque, angularObject, angularVelocity, rotation.value, false);
+        });
         mSetup = true;
     }
     Scene::onImguiUpdate();
     
     if (ImGui::CollapsingHeader("Red Ball Settings"))
     {
-        auto &transform = mEcs.getComponent<Transform>(mRedBall);
+        auto &position = mEcs.getComponent<Position>(mRedBall);
+        auto &rotation = mEcs.getComponent<Rotation>(mRedBall);
+        auto &scale = mEcs.getComponent<Scale>(mRedBall);
         auto &dynamicObject = mEcs.getComponent<DynamicObject>(mRedBall);
         auto &physicsMaterial = mEcs.getComponent<PhysicsMaterial>(mRedBall);
     
         std::string hash = std::to_string(mRedBall);
         
-        ImGui::DragFloat3(std::string("Position##" + hash).c_str(),     glm::value_ptr(transform.position), 0.1f);
-        ImGui::DragFloat4(std::string("Rotation##" + hash).c_str(),     glm::value_ptr(transform.rotation), 0.1f);
-        ImGui::DragFloat3(std::string("Scale##" + hash).c_str(),        glm::value_ptr(transform.scale), 0.1f);
+        ImGui::DragFloat3(std::string("Position##" + hash).c_str(),     glm::value_ptr(position.value), 0.1f);
+        ImGui::DragFloat4(std::string("Rotation##" + hash).c_str(),     glm::value_ptr(rotation.value), 0.1f);
+        ImGui::DragFloat3(std::string("Scale##" + hash).c_str(),        glm::value_ptr(scale.value), 0.1f);
         ImGui::DragFloat3(std::string("Force##" + hash).c_str(),        glm::value_ptr(dynamicObject.force), 0.1f);
         ImGui::DragFloat( std::string("Mass##" + hash).c_str(),         &dynamicObject.mass);
         ImGui::DragFloat3(std::string("Momentum##" + hash).c_str(),     glm::value_ptr(dynamicObject.momentum), 0.1f);
@@ -124,13 +129,15 @@ void PlatformDemoScene::onImguiUpdate()
 
 void PlatformDemoScene::showTransformSettings(Entity entity)
 {
-    auto &transform = mEcs.getComponent<Transform>(entity);
+    auto &position = mEcs.getComponent<Position>(entity);
+    auto &rotation = mEcs.getComponent<Rotation>(entity);
+    auto &scale = mEcs.getComponent<Scale>(entity);
     
     std::string hash = std::to_string(entity);
     
-    ImGui::DragFloat3(std::string("Position##" + hash).c_str(),   glm::value_ptr(transform.position), 0.1f);
-    ImGui::DragFloat4(std::string("Rotation##" + hash).c_str(),   glm::value_ptr(transform.rotation), 0.1f);
-    ImGui::DragFloat3(std::string("Scale##" + hash).c_str(),      glm::value_ptr(transform.scale), 0.1f);
+    ImGui::DragFloat3(std::string("Position##" + hash).c_str(),   glm::value_ptr(position.value), 0.1f);
+    ImGui::DragFloat4(std::string("Rotation##" + hash).c_str(),   glm::value_ptr(rotation.value), 0.1f);
+    ImGui::DragFloat3(std::string("Scale##" + hash).c_str(),      glm::value_ptr(scale.value), 0.1f);
     
-    transform.rotation = glm::normalize(transform.rotation);
+    rotation.value = glm::normalize(rotation.value);
 }
@@ -29,6 +29,7 @@ RotationDemoScene::RotationDemoScene()
     mEcs.add(mAlpha, AngularVelocity { });
     
     Entity floor = createModel(glm::vec3(0.f), mFloor);
+    makeStatic(floor);
     std::shared_ptr<BoundingVolume> floorHitBox = std::make_shared<BoundingBox>(floor, glm::vec3(50.f, 0.1f, 50.f));
     mEcs.add(floor, Velocity { glm::vec3(0.f, 0.0f, 0.f) });
     mEcs.add(floor, floorHitBox);
@@ -58,12 +59,17 @@ void RotationDemoScene::onImguiUpdate()
 {
     if (ImGui::Button("Start Physics") && !mSetup)
     {
-        mEcs.createSystem<Gravity>();
-        mEcs.createSystem<TreeBuilder>(mTree);
-        mEcs.createSystem<CollisionDetection>(mRenderer, mTree);
-        mEcs.createSystem<LinearEulerMethod>();
-        mEcs.createSystem<LinearKinematicSystem>();
-        mEcs.createSystem<AngularEulerMethod>();
+        mEcs.createSystem<TreeBuilder>(mTree, mHierarchy);
+        mEcs.createSystem<CollisionDetection>(mTree, mHierarchy);
+        createSchedulerDispatch();
+        mFixedScheduler->add<DynamicObject>("Gravity", Gravity::apply);
+        mFixedScheduler->add<DynamicObject, Velocity, Position>("Linear Euler", LinearEulerMethod::integrate);
+        mFixedScheduler->add<const Kinematic, const Velocity, Position>("Linear Kinematic", LinearKinematicSystem::integrate);
+        const bool gyroscopic = mGyroscopic;
+        mFixedScheduler->add<Torque, AngularObject, AngularVelocity, Rotation>("Angular Quaternion", [gyroscopic](
+            Torque &torque, AngularObject &angularObject, AngularVelocity &angularVelocity, Rotation &rotation) {
+            AngularQuaternionMethod::integrate(torque, angularObject, angularVelocity, rotation.value, gyroscopic);
+        });
         mSetup = true;
     }
     
@@ -71,16 +77,178 @@ void RotationDemoScene::onImguiUpdate()
     
     if (ImGui::CollapsingHeader("Alpha Settings"))
     {
-        auto &transform = mEcs.getComponent<Transform>(mAlpha);
-        ImGui::DragFloat3("Position", glm::value_ptr(transform.position), 0.1f);
-        ImGui::DragFloat4("Rotation", glm::value_ptr(transform.rotation), 0.1f);
-        ImGui::DragFloat3("Scale", glm::value_ptr(transform.scale), 0.1f);
+        auto &position = mEcs.getComponent<Position>(mAlpha);
+        auto &rotation = mEcs.getComponent<Rotation>(mAlpha);
+        auto &scale = mEcs.getComponent<Scale>(mAlpha);
+        ImGui::DragFloat3("Position", glm::value_ptr(position.value), 0.1f);
+        ImGui::DragFloat4("Rotation", glm::value_ptr(rotation.value), 0.1f);
+        ImGui::DragFloat3("Scale", glm::value_ptr(scale.value), 0.1f);
         auto &torque = mEcs.getComponent<Torque>(mAlpha);
         ImGui::DragFloat3("Torque", glm::value_ptr(torque.tau), 0.1f);
         auto &angularObject = mEcs.getComponent<AngularObject>(mAlpha);
         ImGui::DragFloat3("Angular Momentum", glm::value_ptr(angularObject.angularMomentum), 0.1f);
     }
     
+    if (ImGui::CollapsingHeader("Angular Integration"))
+    {
+        ImGui::Checkbox("Gyroscopic Term", &mGyroscopic);
+        ImGui::SameLine();
+        ImGui::TextDisabled("(?)");
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::BeginTooltip();
+            ImGui::PushTextWrapPos(ImGui::GetFontSize() * 35.0f);
+            ImGui::TextUnformatted("Solves the gyroscopic term semi-implicitly. Must be set before the physics is started.");
+            ImGui::PopTextWrapPos();
+            ImGui::EndTooltip();
+        }
+        
+        if (ImGui::Button("Run Benchmark"))
+        {
+            mBenchmarks.clear();
+            for (const uint32_t bodyCount : { 1'000u, 10'000u, 100'000u })
+                mBenchmarks.push_back(physics::benchmarkAngular(bodyCount));
+        }
+        
+        if (!mBenchmarks.empty() && ImGui::BeginTable("Benchmarks", 3))
+        {
+            ImGui::TableSetupColumn("Bodies");
+            ImGui::TableSetupColumn("Matrix");
+            ImGui::TableSetupColumn("Quaternion");
+            ImGui::TableHeadersRow();
+            for (const auto &benchmark : mBenchmarks)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", benchmark.bodyCount);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.0f", benchmark.matrixBodiesPerMs);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.0f", benchmark.quaternionBodiesPerMs);
+            }
+            ImGui::EndTable();
+            ImGui::TextDisabled("Bodies integrated per millisecond.");
+            
+            const physics::AngularBenchmark &benchmark = mBenchmarks.front();
+            ImGui::Text("Energy drift after 10s - Matrix: %.2e, Quaternion: %.2e, Gyroscopic: %.2e",
+                benchmark.matrixEnergyDrift, benchmark.quaternionEnergyDrift, benchmark.gyroscopicEnergyDrift);
+            if (benchmark.gyroscopicEnergyDrift > 0.f)
+            {
+                ImGui::Text("The gyroscopic term drifts %.0fx less than the quaternion method alone.",
+                    benchmark.quaternionEnergyDrift / benchmark.gyroscopicEnergyDrift);
+            }
+        }
+    }
+    
+    if (ImGui::CollapsingHeader("Parallel ForEach"))
+    {
+        ImGui::TextWrapped("Updates 100k model matrices serially and then in chunks of 1024 on pools with more and more workers.");
+        if (ImGui::Button("Run Parallel Benchmark"))
+            mModelMatrixBenchmark = benchmarkModelMatrixUpdater(100'000);
+        
+        if (mModelMatrixBenchmark.has_value() && ImGui::BeginTable("Parallel Benchmarks", 3))
+        {
+            ImGui::TableSetupColumn("Workers");
+            ImGui::TableSetupColumn("Time (ms)");
+            ImGui::TableSetupColumn("Speed Up");
+            ImGui::TableHeadersRow();
+            
+            const double serialMs = mModelMatrixBenchmark->serialMs;
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("Serial");
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", serialMs);
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("1.00x");
+            
+            const double unchangedMs = mModelMatrixBenchmark->unchangedMs;
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("Unchanged");
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", unchangedMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2fx", unchangedMs > 0.0 ? serialMs / unchangedMs : 0.0);
+            
+            for (const auto &[workers, parallelMs] : mModelMatrixBenchmark->parallelMs)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", workers);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", parallelMs);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2fx", parallelMs > 0.0 ? serialMs / parallelMs : 0.0);
+            }
+            ImGui::EndTable();
+        }
+    }
+    
+    if (ImGui::CollapsingHeader("Transform Hierarchy"))
+    {
+        ImGui::TextWrapped("Fetches the matrix of 50k mesh slots and builds their mvp, as the geometry pass does, with a "
+                           "heap allocated matrix per model and then with the dense hierarchy.");
+        if (ImGui::Button("Run Geometry Pass Benchmark"))
+            mGeometryPassBenchmark = benchmarkGeometryPass(50'000);
+        
+        if (mGeometryPassBenchmark.has_value() && ImGui::BeginTable("Geometry Pass Benchmarks", 3))
+        {
+            ImGui::TableSetupColumn("Matrices");
+            ImGui::TableSetupColumn("Time (ms)");
+            ImGui::TableSetupColumn("Cache Misses");
+            ImGui::TableHeadersRow();
+            
+            const auto row = [](const char *name, const double ms, const std::optional<uint64_t> &misses) {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(name);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", ms);
+                ImGui::TableNextColumn();
+                if (misses.has_value())
+                    ImGui::Text("%llu", static_cast<unsigned long long>(misses.value()));
+                else
+                    ImGui::TextDisabled("n/a");
+            };
+            
+            row("Shared Pointers", mGeometryPassBenchmark->sharedPointerMs, mGeometryPassBenchmark->sharedPointerMisses);
+            row("Hierarchy", mGeometryPassBenchmark->hierarchyMs, mGeometryPassBenchmark->hierarchyMisses);
+            ImGui::EndTable();
+        }
+    }
+    
+    if (ImGui::CollapsingHeader("Transform Streams"))
+    {
+        ImGui::TextWrapped("Runs each system over 100k entities with a single transform component and then with "
+                           "separate position, rotation and scale components.");
+        if (ImGui::Button("Run Transform Stream Benchmark"))
+            mTransformStreamBenchmark = benchmarkTransformStreams(100'000);
+        
+        if (mTransformStreamBenchmark.has_value() && ImGui::BeginTable("Transform Stream Benchmarks", 4))
+        {
+            ImGui::TableSetupColumn("System");
+            ImGui::TableSetupColumn("Transform");
+            ImGui::TableSetupColumn("Streams");
+            ImGui::TableSetupColumn("Speed Up");
+            ImGui::TableHeadersRow();
+            for (const auto &[name, transformEntitiesPerMs, streamEntitiesPerMs] : mTransformStreamBenchmark->systems)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(name);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.0f", transformEntitiesPerMs);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.0f", streamEntitiesPerMs);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2fx", transformEntitiesPerMs > 0.0 ? streamEntitiesPerMs / transformEntitiesPerMs : 0.0);
+            }
+            ImGui::EndTable();
+            ImGui::TextDisabled("Entities updated per millisecond.");
+        }
+    }
+    
     if (ImGui::CollapsingHeader("Octree Debugging"))
     {
         ImGui::TextWrapped("The tree will only be updated once the physics simulation has started.");
@@ -11,6 +11,11 @@
 #include "Ecs.h"
 #include "Scene.h"
 #include "Tree.h"
+#include "AngularBenchmark.h"
+#include "ModelMatrixUpdater.h"
+#include "TransformStreams.h"
+
+#include <optional>
 
 /**
  * @author Ryan Purse
@@ -44,4 +49,10 @@ protected:
     bool mShowBounds        { false };
     bool mShowElementBounds { false };
     bool mSetup             { false };
+    bool mGyroscopic        { true };
+    
+    std::vector<physics::AngularBenchmark> mBenchmarks;
+    std::optional<ModelMatrixBenchmark> mModelMatrixBenchmark;
+    std::optional<GeometryPassBenchmark> mGeometryPassBenchmark;
+    std::optional<TransformStreamBenchmark> mTransformStreamBenchmark;
 };
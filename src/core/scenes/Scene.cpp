@@ -8,6 +8,7 @@
 #include "Scene.h"
 #include "Ecs.h"
 #include "ModelMatrixUpdater.h"
+#include "ModelSpawner.h"
 #include "RotatorSystem.h"
 #include "MaterialComponents.h"
 #include "ModelLoader.h"
@@ -16,71 +17,78 @@
 
 Scene::Scene()
 {
-    // Creation order of systems still matters.
-    mEcs.createSystem<ModelMatrixUpdater>();
-    mEcs.createSystem<RotatorSystem>();
+    // Creation order of systems still matters for anything that is not added to mFixedScheduler.
+    createParallelModelMatrixUpdater(mEcs, mRenderHierarchy, mSnapshots);
+    mEcs.createSystem<TransformSnapshotWriter>(mSnapshots, mHierarchy);
+    mEcs.createSystem<TransformHierarchyUpdater>(mHierarchy, ecs::PreFixedUpdate);
+    
+    // Rotators run on the fixed tick so that the snapshots interpolate them like everything else.
+    mFixedScheduler->add<Rotator, Position, Rotation>("Rotator", RotatorSystem::update);
 }
 
-Entity Scene::createModel(const glm::vec3 position, const Model<PhongVertex, BlinnPhongMaterial> &meshes)
+void Scene::createSchedulerDispatch()
 {
-    // Our transform uniforms that will be distributed to every child in the hierarchy.
-    auto transformUniforms = std::make_shared<ModelMatrix>();
-    
-    Entity parent    = mEcs.create();
-    Entity model     = mEcs.create();  // Just contains model slots for hierarchical purity.
-    
-    // The parent only needs a transform, uniforms for the transform and a model child entity.
-    mEcs.add(parent, model);
-    mEcs.add(parent, Transform { position } );
-    mEcs.add(parent, transformUniforms);
+    if (mIsSchedulerDispatched)
+        return;
     
-    for (const auto &mesh : meshes)
-    {
-        Entity modelSlot = mEcs.create();
-        mEcs.add(model, modelSlot);
-        
-        mEcs.add(modelSlot, mRenderer.geometryTag, mesh.renderInformation);
-        mEcs.add(modelSlot, mesh.material);
-        mEcs.add(modelSlot, transformUniforms);
-    }
-    
-    return parent;
+    Entity entity = mEcs.create();
+    mEcs.add(entity, SchedulerEntity());
+    mEcs.createSystem<SchedulerDispatch>(mFixedScheduler, ecs::FixedUpdate);
+    mIsSchedulerDispatched = true;
+}
+
+Entity Scene::createModel(const glm::vec3 position, const Model<PhongVertex, BlinnPhongMaterial> &meshes)
+{
+    return spawn::model(mEcs, *mHierarchy, spawn::prefab(meshes, mRenderer.geometryTag), Transform { position });
 }
 
 Entity Scene::createModel(const glm::vec3 &position, const Model<PhongVertex, EmissivePbrMaterial> &meshes)
 {
-    // Our transform uniforms that will be distributed to every child in the hierarchy.
-    auto transformUniforms = std::make_shared<ModelMatrix>();
-    
-    Entity parent    = mEcs.create();
-    Entity model     = mEcs.create();  // Just contains model slots for hierarchical purity.
-    
-    // The parent only needs a transform, uniforms for the transform and a model child entity.
-    mEcs.add(parent, model);
-    mEcs.add(parent, Transform { position } );
-    mEcs.add(parent, transformUniforms);
-    
-    for (const auto &mesh : meshes)
-    {
-        Entity modelSlot = mEcs.create();
-        mEcs.add(model, modelSlot);
-        
-        mEcs.add(modelSlot, mRenderer.emissiveTag, mesh.renderInformation);
-        mEcs.add(modelSlot, mesh.material);
-        mEcs.add(modelSlot, transformUniforms);
-    }
-    
-    return parent;
+    return spawn::model(mEcs, *mHierarchy, spawn::prefab(meshes, mRenderer.emissiveTag), Transform { position });
+}
+
+std::vector<Entity> Scene::createModels(
+    const std::vector<Transform> &transforms, const Model<PhongVertex, BlinnPhongMaterial> &meshes)
+{
+    return spawn::models(mEcs, *mHierarchy, spawn::prefab(meshes, mRenderer.geometryTag), transforms);
+}
+
+std::vector<Entity> Scene::createModels(
+    const std::vector<Transform> &transforms, const Model<PhongVertex, EmissivePbrMaterial> &meshes)
+{
+    return spawn::models(mEcs, *mHierarchy, spawn::prefab(meshes, mRenderer.emissiveTag), transforms);
+}
+
+void Scene::makeStatic(Entity entity)
+{
+    const TransformNode node = mEcs.getComponent<TransformNode>(entity);
+    mHierarchy->setLocal(node, Transform {
+        mEcs.getComponent<Position>(entity).value,
+        mEcs.getComponent<Rotation>(entity).value,
+        mEcs.getComponent<Scale>(entity).value });
+    mHierarchy->makeStatic(node);
 }
 
 void Scene::onFixedUpdate()
 {
     mEcs.fixedUpdate();
+    mSnapshots->publish();
 }
 
 void Scene::onUpdate()
 {
     mMainCamera->update();
+}
+
+void Scene::syncRender()
+{
+    mRenderHierarchy->mirror(*mHierarchy);
+    mSnapshots->acquire();
+}
+
+void Scene::updateRenderTransforms()
+{
+    // Only the interpolation of the render hierarchy is scheduled for updates.
     mEcs.update();
 }
 
@@ -96,6 +104,9 @@ void Scene::onImguiUpdate()
     mEcs.imGui();
     mRenderer.imguiUpdate();
     mMainCamera->imguiUpdate();
+    
+    if (ImGui::CollapsingHeader("System Schedule"))
+        mFixedScheduler->imguiUpdate();
 }
 
 void Scene::onImguiMenuUpdate()
@@ -23,8 +23,12 @@
 #include "CollisionResponse.h"
 
 #include "Ecs.h"
+#include "TransformSnapshots.h"
+#include "TransformHierarchy.h"
+#include "SystemScheduler.h"
 
 #include <memory>
+#include <mutex>
 
 /**
  * An abstraction to differentiate from core functionality and ECS Systems
@@ -39,22 +43,84 @@ public:
     
     virtual void onFixedUpdate();
     
+    /** @brief Runs the logic of the scene. Called while holding the simulation mutex. */
     virtual void onUpdate();
     
+    /**
+     * @brief Copies the nodes made or made static since the last call into the render hierarchy, and takes the
+     * latest snapshot published by the fixed update. Must be called while holding the simulation mutex.
+     */
+    void syncRender();
+    
+    /**
+     * @brief Interpolates the render hierarchy between the snapshots that syncRender() took. Runs the ecs update
+     * stage, so it must be called while holding the simulation mutex.
+     */
+    void updateRenderTransforms();
+    
+    /**
+     * @brief Draws the scene from the render hierarchy. Walks the ecs, so it is called while holding the simulation
+     * mutex.
+     */
     virtual void onRender();
     
     virtual void onImguiUpdate();
     
     virtual void onImguiMenuUpdate();
+    
+    /**
+     * @brief Must be held by anything that uses the ecs: the fixed update on the physics thread, and scene logic,
+     * rendering and ImGui on the main thread. The ecs is not thread safe.
+     */
+    std::mutex &simulationMutex() { return mSimulationMutex; }
 
 protected:
     Entity createModel(const glm::vec3 position, const Model<PhongVertex, BlinnPhongMaterial> &meshes);
     Entity createModel(const glm::vec3 &position, const Model<PhongVertex, EmissivePbrMaterial> &meshes);
     
+    /**
+     * @brief Creates one model for each transform in a single pass, which is much faster than calling createModel()
+     * for each one. See spawn::models().
+     * @returns The parent entity of each model, in the same order as transforms.
+     */
+    std::vector<Entity> createModels(
+        const std::vector<Transform> &transforms, const Model<PhongVertex, BlinnPhongMaterial> &meshes);
+    std::vector<Entity> createModels(
+        const std::vector<Transform> &transforms, const Model<PhongVertex, EmissivePbrMaterial> &meshes);
+    
+    /**
+     * @brief Builds the world matrix of entity from its current transform and never updates it again. Only use this for
+     * things that will never move.
+     */
+    void makeStatic(Entity entity);
+    
+    /**
+     * @brief Runs mFixedScheduler at this point in the fixed update: after every FixedUpdate system created before
+     * this call and before every one created after it. Makes the one SchedulerEntity that the dispatch runs on. Only
+     * the first call does anything, and nothing in mFixedScheduler runs until a scene calls it.
+     */
+    void createSchedulerDispatch();
+    
     ecs::Core                   mEcs                { ecs::initFlag::AutoInitialise };
     std::shared_ptr<MainCamera> mMainCamera         { std::make_shared<MainCamera>(glm::vec3(0.f, 10.f, 15.f)) };
-    Renderer                    mRenderer           { mMainCamera, mEcs };
+    
+    /** The world matrix of every model as simulated. Must be declared before anything that collides with them. */
+    std::shared_ptr<TransformHierarchy> mHierarchy  { std::make_shared<TransformHierarchy>() };
+    
+    /**
+     * A copy of mHierarchy with the interpolated transforms, so that rendering never reads what the fixed update
+     * thread is writing. Must be declared before anything that draws.
+     */
+    std::shared_ptr<TransformHierarchy> mRenderHierarchy { std::make_shared<TransformHierarchy>() };
+    Renderer                    mRenderer           { mMainCamera, mEcs, mRenderHierarchy };
     CollisionResponse           mCollisionResponse  { mEcs };
+    
+    std::shared_ptr<TransformSnapshots> mSnapshots  { std::make_shared<TransformSnapshots>() };
+    
+    /** Runs the systems added to it as a graph rather than in creation order. See createSchedulerDispatch(). */
+    std::shared_ptr<SystemScheduler> mFixedScheduler { std::make_shared<SystemScheduler>(mEcs, ecs::PreFixedUpdate) };
+    bool                        mIsSchedulerDispatched { false };
+    std::mutex                  mSimulationMutex;
 };
 
 
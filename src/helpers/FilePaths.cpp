@@ -22,3 +22,8 @@ std::string path::textures()
 {
     return TEXTURE_PATH;
 }
+
+std::string path::shaderCache()
+{
+    return SHADER_CACHE_PATH;
+}
@@ -13,21 +13,13 @@
 MipViewer::MipViewer(std::shared_ptr<TextureBufferObject> inputTexture, std::string_view debugName) :
     mInputTexture(std::move(inputTexture)), mDebugName(debugName)
 {
-    const auto mesh = primitives::plane<UvVertex>()[0];
-    mVao      = mesh.renderInformation.vao;
-    mEboCount = mesh.renderInformation.eboCount;
-    mEbo      = mesh.ebo;
-    mVbo      = mesh.vbo;
-    
     mOriginalSize = mInputTexture->getSize();
     init();
 }
 
 MipViewer::~MipViewer()
 {
-    glDeleteVertexArrays(1, &mVao);
-    glDeleteBuffers(1, &mEbo);
-    glDeleteBuffers(1, &mVbo);
+    destroy::mesh(mQuad);
 }
 
 void MipViewer::init()
@@ -47,13 +39,13 @@ void MipViewer::render()
     mShader.bind();
     mFramebufferObject->bind();
     
-    mShader.set("u_mip_level", mLevel);
-    mShader.set("u_mip_size", glm::vec2(mSize));
-    mShader.set("u_texture", mInputTexture->getName(), 2);
-    mShader.set("u_mvp_matrix", glm::mat4(1.f));
+    mMipLevel.set(mLevel);
+    mMipSize.set(glm::vec2(mSize));
+    mTexture.set({ mInputTexture->getName(), 2 });
+    mMvpMatrix.set(glm::mat4(1.f));
     
-    glBindVertexArray(mVao);
-    glDrawElements(GL_TRIANGLES, mEboCount, GL_UNSIGNED_INT, 0);
+    glBindVertexArray(mQuad.renderInformation.vao);
+    drawElements(mQuad.renderInformation);
 }
 
 void MipViewer::clear()
@@ -7,10 +7,13 @@
 
 #include "Timers.h"
 
+#include <chrono>
+
 namespace timers
 {
     double deltaTime_impl    { 0.16f };
-    double fixedTime_impl    { 0.01f };  // 100 Ticks per second.
+    thread_local double fixedTime_impl { 0.01f };  // 100 Ticks per second.
+    Clock  clock_impl        { steadyClock };
     
     static double current           { 0 };
     static double last              { 0 };
@@ -22,9 +25,20 @@ namespace timers
         updateDeltaTime_impl();
     }
     
+    double steadyClock()
+    {
+        static const auto start = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    
+    void setClock(const Clock clock)
+    {
+        clock_impl = clock;
+    }
+    
     void updateDeltaTime_impl()
     {
-        current = glfwGetTime();
+        current = getTicks<double>();
         deltaTime_impl = current - last;
         last = current;
     }
@@ -0,0 +1,98 @@
+/**
+ * @file WorkStealingPool.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "WorkStealingPool.h"
+
+WorkStealingPool::WorkStealingPool(const uint32_t workerCount)
+{
+    for (uint32_t i = 0; i < std::max(workerCount, 1u); ++i)
+        mQueues.push_back(std::make_unique<Queue>());
+    
+    for (uint32_t i = 0; i < workerCount; ++i)
+        mWorkers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::scoped_lock lock(mSleepMutex);
+        mRunning = false;
+    }
+    mWake.notify_all();
+    
+    for (std::thread &worker : mWorkers)
+        worker.join();
+}
+
+WorkStealingPool &WorkStealingPool::instance()
+{
+    // The main and physics threads help with their own work, so they are not given workers.
+    static WorkStealingPool pool(std::max(std::thread::hardware_concurrency(), 2u) - 2);
+    return pool;
+}
+
+void WorkStealingPool::push(const uint32_t queue, Task task)
+{
+    {
+        std::scoped_lock lock(mQueues[queue]->mutex);
+        mQueues[queue]->tasks.push_back(std::move(task));
+    }
+    ++mQueued;
+}
+
+void WorkStealingPool::wakeWorkers()
+{
+    // Taking the lock orders the pushes before any worker that is between checking for work and going to sleep.
+    {
+        std::scoped_lock lock(mSleepMutex);
+    }
+    mWake.notify_all();
+}
+
+bool WorkStealingPool::runTask(const uint32_t queue)
+{
+    Task task;
+    const auto queueCount = static_cast<uint32_t>(mQueues.size());
+    for (uint32_t i = 0; i < queueCount && !task; ++i)
+    {
+        Queue &victim = *mQueues[(queue + i) % queueCount];
+        std::scoped_lock lock(victim.mutex);
+        if (victim.tasks.empty())
+            continue;
+        
+        // The owner takes the newest task, which is the most likely to still be in its cache.
+        if (i == 0)
+        {
+            task = std::move(victim.tasks.back());
+            victim.tasks.pop_back();
+        }
+        else
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+        }
+    }
+    
+    if (!task)
+        return false;
+    
+    --mQueued;
+    task();
+    return true;
+}
+
+void WorkStealingPool::workerLoop(const uint32_t index)
+{
+    while (mRunning)
+    {
+        if (runTask(index))
+            continue;
+        
+        std::unique_lock lock(mSleepMutex);
+        mWake.wait(lock, [this]() { return mQueued > 0 || !mRunning; });
+    }
+}
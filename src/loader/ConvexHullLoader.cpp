@@ -0,0 +1,37 @@
+/**
+ * @file ConvexHullLoader.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "ConvexHullLoader.h"
+#include "ModelLoader.h"
+
+namespace load
+{
+    std::shared_ptr<const ConvexHull> convexHull(std::string_view path, uint32_t vertexBudget)
+    {
+        static std::unordered_map<std::string, std::shared_ptr<const ConvexHull>> cache;
+        
+        const std::string key = std::string(path) + "#" + std::to_string(vertexBudget);
+        if (cache.count(key) > 0)
+            return cache.at(key);
+        
+        const auto [meshes, materials] = parseObject<ObjVertex, NoMaterial>(path);
+        
+        std::vector<glm::vec3> points;
+        for (const auto &[name, rawMesh] : meshes)
+        {
+            for (const ObjVertex &vertex : rawMesh.vertices())
+                points.emplace_back(vertex.position);
+        }
+        
+        auto hull = std::make_shared<const ConvexHull>(points, vertexBudget);
+        debug::log("Built a convex hull with " + std::to_string(hull->vertexCount()) + " vertices from "
+                   + std::to_string(points.size()) + " (" + std::string(path) + ")");
+        
+        cache.emplace(key, hull);
+        return hull;
+    }
+}
@@ -0,0 +1,91 @@
+/**
+ * @file AngularBenchmark.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "AngularBenchmark.h"
+#include "PhysicsSystems.h"
+#include "Components.h"
+#include "Timers.h"
+
+namespace physics
+{
+    namespace
+    {
+        struct BenchmarkBody
+        {
+            Torque          torque;
+            AngularObject   angularObject;
+            AngularVelocity angularVelocity;
+            Rotation        rotation;
+        };
+        
+        /** A box with a different inertia around each axis, so that it precesses while it spins. */
+        BenchmarkBody makeSpinningBody(const glm::vec3 &angularMomentum)
+        {
+            BenchmarkBody body;
+            body.angularObject.inverseBodyInertia = glm::mat3(
+                1.f, 0.f,       0.f,
+                0.f, 1.f / 2.f, 0.f,
+                0.f, 0.f,       1.f / 3.f);
+            body.angularObject.angularMomentum = angularMomentum;
+            return body;
+        }
+        
+        std::vector<BenchmarkBody> makeBenchmarkBodies(const uint32_t bodyCount)
+        {
+            std::vector<BenchmarkBody> bodies;
+            bodies.reserve(bodyCount);
+            for (uint32_t i = 0; i < bodyCount; ++i)
+                bodies.emplace_back(makeSpinningBody(i % 2 == 0 ? glm::vec3(0.f) : glm::vec3(0.2f, 0.2f, 5.f)));
+            return bodies;
+        }
+        
+        float kineticEnergy(const AngularObject &angularObject, const glm::quat &rotation)
+        {
+            const glm::mat3 matrix = glm::mat3_cast(rotation);
+            const glm::mat3 inverseInertia = matrix * angularObject.inverseBodyInertia * glm::transpose(matrix);
+            return 0.5f * glm::dot(angularObject.angularMomentum, inverseInertia * angularObject.angularMomentum);
+        }
+        
+        template<typename TFunction>
+        float energyDrift(const uint32_t steps, TFunction &&step)
+        {
+            BenchmarkBody body = makeSpinningBody(glm::vec3(0.2f, 0.2f, 5.f));
+            const float initialEnergy = kineticEnergy(body.angularObject, body.rotation.value);
+            for (uint32_t i = 0; i < steps; ++i)
+                step(body);
+            return glm::abs(kineticEnergy(body.angularObject, body.rotation.value) - initialEnergy) / initialEnergy;
+        }
+    }
+    
+    AngularBenchmark benchmarkAngular(const uint32_t bodyCount, const uint32_t steps, const uint32_t driftSteps)
+    {
+        AngularBenchmark result { bodyCount };
+        std::vector<BenchmarkBody> bodies = makeBenchmarkBodies(bodyCount);
+        result.matrixBodiesPerMs = timers::itemsPerMs(bodyCount, steps, [&]() {
+            for (auto &[torque, angularObject, angularVelocity, rotation] : bodies)
+                AngularEulerMethod::integrate(torque, angularObject, angularVelocity, rotation);
+        });
+        
+        bodies = makeBenchmarkBodies(bodyCount);
+        result.quaternionBodiesPerMs = timers::itemsPerMs(bodyCount, steps, [&]() {
+            for (auto &[torque, angularObject, angularVelocity, rotation] : bodies)
+                AngularQuaternionMethod::integrate(torque, angularObject, angularVelocity, rotation.value, false);
+        });
+        
+        result.matrixEnergyDrift = energyDrift(driftSteps, [](BenchmarkBody &body) {
+            AngularEulerMethod::integrate(body.torque, body.angularObject, body.angularVelocity, body.rotation);
+        });
+        result.quaternionEnergyDrift = energyDrift(driftSteps, [](BenchmarkBody &body) {
+            AngularQuaternionMethod::integrate(body.torque, body.angularObject, body.angularVelocity, body.rotation.value, false);
+        });
+        result.gyroscopicEnergyDrift = energyDrift(driftSteps, [](BenchmarkBody &body) {
+            AngularQuaternionMethod::integrate(body.torque, body.angularObject, body.angularVelocity, body.rotation.value, true);
+        });
+        
+        return result;
+    }
+}
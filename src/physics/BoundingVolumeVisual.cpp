@@ -6,35 +6,46 @@
 
 
 #include "BoundingVolumeVisual.h"
+#include "ConvexHull.h"
+#include "ModelDestroyer.h"
+#include "ext/matrix_transform.hpp"
 
 
-BoundingVolumeVisual::BoundingVolumeVisual(std::shared_ptr<MainCamera> camera, const unsigned int geometryBufferId) :
-    mCamera(std::move(camera)), mFbo(geometryBufferId)
+BoundingVolumeVisual::BoundingVolumeVisual(
+    std::shared_ptr<MainCamera> camera, const unsigned int geometryBufferId, std::shared_ptr<TransformHierarchy> hierarchy) :
+    mCamera(std::move(camera)), mHierarchy(std::move(hierarchy)), mFbo(geometryBufferId)
 {
     mEntities.forEach([this](
         std::shared_ptr<BoundingVolume> &boundingVolume,
-        std::shared_ptr<ModelMatrix> &basicUniforms)
+        const TransformNode &node)
     {
+        const glm::mat4 &modelMatrix = mHierarchy->world(node);
         if (const auto sphere = std::dynamic_pointer_cast<BoundingSphere>(boundingVolume))
-            drawSphere(*sphere, basicUniforms->value);
+            drawSphere(*sphere, modelMatrix);
         else if (const auto box = std::dynamic_pointer_cast<BoundingBox>(boundingVolume))
-            drawBox(*box, basicUniforms->value);
+            drawBox(*box, modelMatrix);
+        else if (const auto hull = std::dynamic_pointer_cast<BoundingConvexHull>(boundingVolume))
+            drawBox(BoundingBox(hull->entity, hull->hull->halfSize()), glm::translate(modelMatrix, hull->hull->centre()));
     });
     scheduleFor(ecs::Render);
 }
 
+BoundingVolumeVisual::~BoundingVolumeVisual()
+{
+    destroy::mesh(mSphere);
+    destroy::mesh(mBox);
+}
+
 void BoundingVolumeVisual::drawSphere(const BoundingSphere &boundingSphere, const glm::mat4 &modelMatrix)
 {
     mSphereShader.bind();
     glBindFramebuffer(GL_FRAMEBUFFER, mFbo);
     glBindVertexArray(mSphere.renderInformation.vao);
     
-    mSphereShader.set("u_mvp", mCamera->getVpMatrix() * modelMatrix);
-    mSphereShader.set("u_model_matrix", modelMatrix);
-    mSphereShader.set("u_radius", boundingSphere.radius);
-    mSphereShader.set("u_camera_position_ws", mCamera->getPosition());
+    mSphereModelMatrix.set(modelMatrix);
+    mSphereRadius.set(boundingSphere.radius);
     
-    glDrawElements(GL_LINES, mSphere.renderInformation.eboCount, GL_UNSIGNED_INT, 0);
+    drawElements(mSphere.renderInformation, GL_LINES);
 }
 
 void BoundingVolumeVisual::drawBox(const BoundingBox &boundingBox, const glm::mat4 &modelMatrix)
@@ -43,10 +54,8 @@ void BoundingVolumeVisual::drawBox(const BoundingBox &boundingBox, const glm::ma
     glBindFramebuffer(GL_FRAMEBUFFER, mFbo);
     glBindVertexArray(mBox.renderInformation.vao);
     
-    mBoxShader.set("u_mvp", mCamera->getVpMatrix() * modelMatrix);
-    mBoxShader.set("u_model_matrix", modelMatrix);
-    mBoxShader.set("u_halfsize", boundingBox.halfSize);
-    mBoxShader.set("u_camera_position_ws", mCamera->getPosition());
+    mBoxModelMatrix.set(modelMatrix);
+    mBoxHalfSize.set(boundingBox.halfSize);
     
-    glDrawElements(GL_LINES, mBox.renderInformation.eboCount, GL_UNSIGNED_INT, 0);
+    drawElements(mBox.renderInformation, GL_LINES);
 }
@@ -7,31 +7,33 @@
 
 #include "CollisionDetection.h"
 #include "PhysicsHelpers.h"
-#include "Renderer.h"
 #include "Timers.h"
 
 #include <numeric>
 #include "gtx/component_wise.hpp"
+#include "ext/matrix_transform.hpp"
 #include <unordered_set>
 
-CollisionDetection::CollisionDetection(Renderer &renderer, std::shared_ptr<octree::Tree<CollisionEntity>> tree) :
-    mRenderer(renderer), mTree(std::move(tree))
+CollisionDetection::CollisionDetection(
+    std::shared_ptr<octree::Tree<CollisionEntity>> tree, std::shared_ptr<TransformHierarchy> hierarchy) :
+    mTree(std::move(tree)), mHierarchy(std::move(hierarchy))
 {
     mEntities.forEach([this](
         std::shared_ptr<BoundingVolume> &boundingVolume,
-        std::shared_ptr<ModelMatrix> &basicUniforms,
+        const TransformNode &node,
         const Velocity &velocity)
     {
-        const glm::vec3 center = basicUniforms->value * glm::vec4(velocity.value * timers::fixedTime<float>(), 1.f);
+        const glm::mat4 &modelMatrix = mHierarchy->world(node);
+        const glm::vec3 center = modelMatrix * glm::vec4(velocity.value * timers::fixedTime<float>(), 1.f);
         if (auto sphere = std::dynamic_pointer_cast<BoundingSphere>(boundingVolume))
         {
             octree::AABB bounds { center, glm::vec3(sphere->radius) };
             
-            traverseTree(sphere, basicUniforms, velocity, bounds);
+            traverseTree(sphere, node, velocity, bounds);
         }
         if (auto box = std::dynamic_pointer_cast<BoundingBox>(boundingVolume))
         {
-            auto points = physics::boxToVertex(basicUniforms->value, box->halfSize);
+            auto points = physics::boxToVertex(modelMatrix, box->halfSize);
             glm::vec3 max = glm::vec3(0.f);
             
             for (auto &point : points)
@@ -40,7 +42,15 @@ CollisionDetection::CollisionDetection(Renderer &renderer, std::shared_ptr<octre
             max = (max - glm::abs(center));
             octree::AABB bounds { center, max };
             
-            traverseTree(box, basicUniforms, velocity, bounds);
+            traverseTree(box, node, velocity, bounds);
+        }
+        if (auto hull = std::dynamic_pointer_cast<BoundingConvexHull>(boundingVolume))
+        {
+            const glm::mat4 movedMatrix = glm::translate(modelMatrix, velocity.value * timers::fixedTime<float>());
+            const auto [hullCenter, halfSize] = physics::axisAlignedBounds(movedMatrix, hull->hull->centre(), hull->hull->halfSize());
+            octree::AABB bounds { hullCenter, halfSize };
+            
+            traverseTree(hull, node, velocity, bounds);
         }
     });
     scheduleFor(ecs::FixedUpdate);
@@ -118,13 +128,50 @@ std::vector<HitRecord> CollisionDetection::collisionCheck(
     return hitRecords;
 }
 
+HitRecord CollisionDetection::collisionCheck(
+    const BoundingConvexHull &lhs, const glm::mat4 &lhsModelMat, const glm::vec3 &lhsVelocity,
+    const BoundingSphere &rhs,     const glm::mat4 &rhsModelMat, const glm::vec3 &rhsVelocity)
+{
+    const gjk::Shape lhsShape(*lhs.hull, glm::translate(lhsModelMat, lhsVelocity * timers::fixedTime<float>()));
+    const gjk::Shape rhsShape(rhs.radius, glm::translate(rhsModelMat, rhsVelocity * timers::fixedTime<float>()));
+    return convexCheck(lhsShape, rhsShape);
+}
+
+HitRecord CollisionDetection::collisionCheck(
+    const BoundingConvexHull &lhs, const glm::mat4 &lhsModelMat, const glm::vec3 &lhsVelocity,
+    const BoundingBox &rhs,        const glm::mat4 &rhsModelMat, const glm::vec3 &rhsVelocity)
+{
+    const gjk::Shape lhsShape(*lhs.hull, glm::translate(lhsModelMat, lhsVelocity * timers::fixedTime<float>()));
+    const gjk::Shape rhsShape(rhs.halfSize, glm::translate(rhsModelMat, rhsVelocity * timers::fixedTime<float>()));
+    return convexCheck(lhsShape, rhsShape);
+}
+
+HitRecord CollisionDetection::collisionCheck(
+    const BoundingConvexHull &lhs, const glm::mat4 &lhsModelMat, const glm::vec3 &lhsVelocity,
+    const BoundingConvexHull &rhs, const glm::mat4 &rhsModelMat, const glm::vec3 &rhsVelocity)
+{
+    const gjk::Shape lhsShape(*lhs.hull, glm::translate(lhsModelMat, lhsVelocity * timers::fixedTime<float>()));
+    const gjk::Shape rhsShape(*rhs.hull, glm::translate(rhsModelMat, rhsVelocity * timers::fixedTime<float>()));
+    return convexCheck(lhsShape, rhsShape);
+}
+
+HitRecord CollisionDetection::convexCheck(const gjk::Shape &lhs, const gjk::Shape &rhs)
+{
+    const gjk::DistanceResult distance = gjk::distance(lhs, rhs);
+    if (!distance.intersecting)
+        return { false };
+    
+    const gjk::PenetrationResult penetration = gjk::penetration(lhs, rhs, distance.simplex);
+    return { true, penetration.pointA, penetration.normal };
+}
+
 void CollisionDetection::traverseTree(
     std::shared_ptr<BoundingSphere> lhsEntity,
-    std::shared_ptr<ModelMatrix> &uniforms,
+    const TransformNode &node,
     const Velocity &velocity,
     octree::AABB bounds)
 {
-    const glm::mat4 &lhsModelMatrix = uniforms->value;
+    const glm::mat4 &lhsModelMatrix = mHierarchy->world(node);
     const glm::vec3 &lhsVelocity = velocity.value;
     
     std::vector<CollisionEntity> intersectingEntities = mTree->getIntersecting(bounds);
@@ -133,7 +180,7 @@ void CollisionDetection::traverseTree(
         if (rhsEntity.boundingVolume->entity == lhsEntity->entity)
             continue;
     
-        const glm::mat4 &rhsModelMatrix = rhsEntity.basicUniforms->value;
+        const glm::mat4 &rhsModelMatrix = mHierarchy->world(rhsEntity.node);
         const glm::vec3 &rhsVelocity = rhsEntity.velocity.value;
     
         if (auto rhsSphere = std::dynamic_pointer_cast<BoundingSphere>(rhsEntity.boundingVolume))
@@ -148,16 +195,22 @@ void CollisionDetection::traverseTree(
             if (record.hit)
                 lhsEntity->callbacks.broadcast(lhsEntity->entity, rhsBox->entity, record.position, record.normal);
         }
+        if (auto rhsHull = std::dynamic_pointer_cast<BoundingConvexHull>(rhsEntity.boundingVolume))
+        {
+            HitRecord record = collisionCheck(*rhsHull, rhsModelMatrix, rhsVelocity, *lhsEntity, lhsModelMatrix, lhsVelocity);
+            if (record.hit)
+                lhsEntity->callbacks.broadcast(lhsEntity->entity, rhsHull->entity, record.position, record.normal);
+        }
     }
 }
 
 void CollisionDetection::traverseTree(
     std::shared_ptr<BoundingBox> lhsEntity,
-    std::shared_ptr<ModelMatrix> &uniforms,
+    const TransformNode &node,
     const Velocity &velocity,
     octree::AABB bounds)
 {
-    const glm::mat4 &lhsModelMatrix = uniforms->value;
+    const glm::mat4 &lhsModelMatrix = mHierarchy->world(node);
     const glm::vec3 &lhsVelocity = velocity.value;
     
     std::vector<CollisionEntity> intersectingEntities = mTree->getIntersecting(bounds);
@@ -166,7 +219,7 @@ void CollisionDetection::traverseTree(
         if (rhsEntity.boundingVolume->entity == lhsEntity->entity)
             continue;
     
-        const glm::mat4 &rhsModelMatrix = rhsEntity.basicUniforms->value;
+        const glm::mat4 &rhsModelMatrix = mHierarchy->world(rhsEntity.node);
         const glm::vec3 &rhsVelocity = rhsEntity.velocity.value;
     
         if (auto rhsSphere = std::dynamic_pointer_cast<BoundingSphere>(rhsEntity.boundingVolume))
@@ -204,5 +257,44 @@ void CollisionDetection::traverseTree(
         
             lhsEntity->callbacks.broadcast(lhsEntity->entity, rhsBox->entity, hit.position, hit.normal);
         }
+        if (auto rhsHull = std::dynamic_pointer_cast<BoundingConvexHull>(rhsEntity.boundingVolume))
+        {
+            HitRecord record = collisionCheck(*rhsHull, rhsModelMatrix, rhsVelocity, *lhsEntity, lhsModelMatrix, lhsVelocity);
+            if (record.hit)
+                lhsEntity->callbacks.broadcast(lhsEntity->entity, rhsHull->entity, record.position, record.normal);
+        }
+    }
+}
+
+void CollisionDetection::traverseTree(
+    std::shared_ptr<BoundingConvexHull> lhsEntity,
+    const TransformNode &node,
+    const Velocity &velocity,
+    octree::AABB bounds)
+{
+    const glm::mat4 &lhsModelMatrix = mHierarchy->world(node);
+    const glm::vec3 &lhsVelocity = velocity.value;
+    
+    std::vector<CollisionEntity> intersectingEntities = mTree->getIntersecting(bounds);
+    for (const auto &rhsEntity : intersectingEntities)
+    {
+        if (rhsEntity.boundingVolume->entity == lhsEntity->entity)
+            continue;
+        
+        const glm::mat4 &rhsModelMatrix = mHierarchy->world(rhsEntity.node);
+        const glm::vec3 &rhsVelocity = rhsEntity.velocity.value;
+        
+        HitRecord record;
+        if (auto rhsSphere = std::dynamic_pointer_cast<BoundingSphere>(rhsEntity.boundingVolume))
+            record = collisionCheck(*lhsEntity, lhsModelMatrix, lhsVelocity, *rhsSphere, rhsModelMatrix, rhsVelocity);
+        else if (auto rhsBox = std::dynamic_pointer_cast<BoundingBox>(rhsEntity.boundingVolume))
+            record = collisionCheck(*lhsEntity, lhsModelMatrix, lhsVelocity, *rhsBox, rhsModelMatrix, rhsVelocity);
+        else if (auto rhsHull = std::dynamic_pointer_cast<BoundingConvexHull>(rhsEntity.boundingVolume))
+            record = collisionCheck(*lhsEntity, lhsModelMatrix, lhsVelocity, *rhsHull, rhsModelMatrix, rhsVelocity);
+        
+        // Like the box checks, hits are reported with the normal pointing out of the other body.
+        record.normal *= -1.f;
+        if (record.hit)
+            lhsEntity->callbacks.broadcast(lhsEntity->entity, rhsEntity.boundingVolume->entity, record.position, record.normal);
     }
 }
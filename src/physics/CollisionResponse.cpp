@@ -26,8 +26,14 @@ void CollisionResponse::makePhysicsObject(
     if (!mEcs.hasComponent<Velocity>(entity))
         mEcs.add(entity, Velocity { velocity } );
     
-    if (!mEcs.hasComponent<Transform>(entity))
-        mEcs.add(entity, Transform {  } );
+    if (!mEcs.hasComponent<Position>(entity))
+        mEcs.add(entity, Position {  } );
+    
+    if (!mEcs.hasComponent<Rotation>(entity))
+        mEcs.add(entity, Rotation {  } );
+    
+    if (!mEcs.hasComponent<Scale>(entity))
+        mEcs.add(entity, Scale {  } );
     
     if (!mEcs.hasComponent<PhysicsMaterial>(entity))
         mEcs.add(entity, PhysicsMaterial { bounciness } );
@@ -65,6 +71,23 @@ void CollisionResponse::makeBoundingSphere(const Entity entity, const bool isDyn
     }
 }
 
+void CollisionResponse::makeConvexHull(const Entity entity, std::shared_ptr<const ConvexHull> hull, const bool isDynamic)
+{
+    if (!mEcs.hasComponent<std::shared_ptr<BoundingVolume>>(entity))
+    {
+        std::shared_ptr<BoundingVolume> boundingVolume = std::make_shared<BoundingConvexHull>(entity, std::move(hull));
+        if (isDynamic)
+            boundingVolume->callbacks.subscribe([this](
+                Entity entity, Entity other, const glm::vec3 &position, const glm::vec3 &normal) {
+                pushOutResponse(entity, other, position, normal);
+            });
+        
+        mEcs.add(entity, boundingVolume);
+    }
+    if (!mEcs.hasComponent<Velocity>(entity))
+        mEcs.add(entity, Velocity {  } );
+}
+
 void CollisionResponse::response(Entity entity, Entity other, const glm::vec3 &position, const glm::vec3 &normal)
 {
     if (mEcs.hasComponent<AngularObject>(entity))
@@ -77,11 +100,20 @@ void CollisionResponse::response(Entity entity, Entity other, const glm::vec3 &p
         staticCollision(entity, other, position, normal);
 }
 
+void CollisionResponse::pushOutResponse(Entity entity, Entity other, const glm::vec3 &position, const glm::vec3 &normal)
+{
+    if (mEcs.hasComponent<AngularObject>(entity))
+        staticRotationalCollision(entity, other, position, normal);
+    else if (mEcs.hasComponent<DynamicObject>(other))
+        dynamicCollision(entity, other, position, -normal);
+    else
+        staticCollision(entity, other, position, normal);
+}
+
 void CollisionResponse::staticCollision(Entity entity, Entity other, const glm::vec3 &position, const glm::vec3 &normal)
 {
     auto &dynamicObject           = mEcs.getComponent<DynamicObject>(entity);
     auto &velocity                = mEcs.getComponent<Velocity>(entity);
-    const auto &transform         = mEcs.getComponent<Transform>(entity);
     const auto &physicsMaterial   = mEcs.getComponent<PhysicsMaterial>(entity);
     
     const float vRel        = glm::dot(normal, velocity.value);
@@ -98,7 +130,6 @@ void CollisionResponse::typedStaticCollision(Component dynamicType, Entity entit
 {
     auto &dynamicObject           = mEcs.getComponent<DynamicObject>(entity, dynamicType);
     auto &velocity                = mEcs.getComponent<Velocity>(entity);
-    const auto &transform         = mEcs.getComponent<Transform>(entity);
     const auto &physicsMaterial   = mEcs.getComponent<PhysicsMaterial>(entity);
     
     const float vRel        = glm::dot(normal, velocity.value);
@@ -146,7 +177,6 @@ void CollisionResponse::staticRotationalCollision(
 {
     auto &dynamicObject           = mEcs.getComponent<DynamicObject>(entity);
     auto &velocity                = mEcs.getComponent<Velocity>(entity);
-    const auto &transform         = mEcs.getComponent<Transform>(entity);
     const auto &physicsMaterial   = mEcs.getComponent<PhysicsMaterial>(entity);
     auto &angularObject           = mEcs.getComponent<AngularObject>(entity);
     auto &angularVelocity         = mEcs.getComponent<AngularVelocity>(entity);
@@ -0,0 +1,314 @@
+/**
+ * @file ConvexHull.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "ConvexHull.h"
+
+#include <array>
+#include <limits>
+#include <unordered_set>
+
+namespace
+{
+    struct HullFace
+    {
+        uint32_t                a;
+        uint32_t                b;
+        uint32_t                c;
+        glm::vec3               normal              { 0.f };
+        float                   offset              { 0.f };
+        std::vector<uint32_t>   outside;
+        uint32_t                furthest            { 0 };
+        float                   furthestDistance    { 0.f };
+        bool                    alive               { true };
+    };
+    
+    HullFace makeFace(const std::vector<glm::vec3> &points, const uint32_t a, const uint32_t b, const uint32_t c)
+    {
+        HullFace face { a, b, c };
+        face.normal = glm::normalize(glm::cross(points[b] - points[a], points[c] - points[a]));
+        face.offset = glm::dot(face.normal, points[a]);
+        return face;
+    }
+    
+    float distanceTo(const HullFace &face, const glm::vec3 &point)
+    {
+        return glm::dot(face.normal, point) - face.offset;
+    }
+    
+    /**
+     * @brief Gives the point to the face that it is the furthest in front of.
+     * @returns False if the point is not in front of any face (it is inside of the hull).
+     */
+    bool assignOutside(
+        std::vector<HullFace> &faces, const size_t firstFace,
+        const std::vector<glm::vec3> &points, const uint32_t index, const float epsilon)
+    {
+        float bestDistance = epsilon;
+        HullFace *bestFace = nullptr;
+        for (size_t i = firstFace; i < faces.size(); ++i)
+        {
+            if (!faces[i].alive)
+                continue;
+            
+            const float distance = distanceTo(faces[i], points[index]);
+            if (distance > bestDistance)
+            {
+                bestDistance = distance;
+                bestFace = &faces[i];
+            }
+        }
+        
+        if (bestFace == nullptr)
+            return false;
+        
+        bestFace->outside.emplace_back(index);
+        if (bestDistance > bestFace->furthestDistance)
+        {
+            bestFace->furthestDistance = bestDistance;
+            bestFace->furthest = index;
+        }
+        return true;
+    }
+    
+    uint64_t edgeKey(const uint32_t from, const uint32_t to)
+    {
+        return (static_cast<uint64_t>(from) << 32) | to;
+    }
+}
+
+ConvexHull::ConvexHull(const std::vector<glm::vec3> &points, uint32_t vertexBudget)
+{
+    vertexBudget = std::max(vertexBudget, 4u);
+    if (points.size() < 4)
+    {
+        setVertices(points);
+        return;
+    }
+    
+    // The extreme points on each axis are used to seed the initial tetrahedron.
+    std::array<uint32_t, 6> extremes { };
+    for (uint32_t i = 0; i < points.size(); ++i)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            if (points[i][axis] < points[extremes[axis * 2]][axis])
+                extremes[axis * 2] = i;
+            if (points[i][axis] > points[extremes[axis * 2 + 1]][axis])
+                extremes[axis * 2 + 1] = i;
+        }
+    }
+    
+    const glm::vec3 extent {
+        points[extremes[1]].x - points[extremes[0]].x,
+        points[extremes[3]].y - points[extremes[2]].y,
+        points[extremes[5]].z - points[extremes[4]].z };
+    const float epsilon = 1e-5f * glm::length(extent);
+    
+    uint32_t i0 = extremes[0];
+    uint32_t i1 = extremes[1];
+    for (const uint32_t lhs : extremes)
+    {
+        for (const uint32_t rhs : extremes)
+        {
+            if (glm::length(points[rhs] - points[lhs]) > glm::length(points[i1] - points[i0]))
+            {
+                i0 = lhs;
+                i1 = rhs;
+            }
+        }
+    }
+    
+    uint32_t i2 = i0;
+    float bestDistance = epsilon;
+    for (uint32_t i = 0; i < points.size(); ++i)
+    {
+        const float distance = glm::length(glm::cross(points[i] - points[i0], glm::normalize(points[i1] - points[i0])));
+        if (distance > bestDistance)
+        {
+            bestDistance = distance;
+            i2 = i;
+        }
+    }
+    
+    uint32_t i3 = i0;
+    if (i2 != i0)
+    {
+        bestDistance = epsilon;
+        const glm::vec3 baseNormal = glm::normalize(glm::cross(points[i1] - points[i0], points[i2] - points[i0]));
+        for (uint32_t i = 0; i < points.size(); ++i)
+        {
+            const float distance = glm::abs(glm::dot(baseNormal, points[i] - points[i0]));
+            if (distance > bestDistance)
+            {
+                bestDistance = distance;
+                i3 = i;
+            }
+        }
+    }
+    
+    if (i3 == i0)
+    {
+        // The mesh is flat. The extreme points are enough for a support function.
+        std::vector<glm::vec3> flat;
+        for (const uint32_t index : std::unordered_set<uint32_t>(extremes.begin(), extremes.end()))
+            flat.emplace_back(points[index]);
+        setVertices(flat);
+        return;
+    }
+    
+    const glm::vec3 centroid = (points[i0] + points[i1] + points[i2] + points[i3]) / 4.f;
+    const std::array<std::array<uint32_t, 3>, 4> seedFaces {{ { i0, i1, i2 }, { i0, i3, i1 }, { i1, i3, i2 }, { i2, i3, i0 } }};
+    
+    std::vector<HullFace> faces;
+    for (const auto &[a, b, c] : seedFaces)
+    {
+        HullFace face = makeFace(points, a, b, c);
+        if (distanceTo(face, centroid) > 0.f)
+            face = makeFace(points, a, c, b);
+        faces.emplace_back(std::move(face));
+    }
+    
+    for (uint32_t i = 0; i < points.size(); ++i)
+    {
+        if (i != i0 && i != i1 && i != i2 && i != i3)
+            assignOutside(faces, 0, points, i, epsilon);
+    }
+    
+    for (uint32_t hullVertexCount = 4; hullVertexCount < vertexBudget; ++hullVertexCount)
+    {
+        // Always expand towards the point that is the furthest outside so that the budget is spent on the
+        // vertices that change the shape the most.
+        const HullFace *expandingFace = nullptr;
+        for (const HullFace &face : faces)
+        {
+            if (face.alive && !face.outside.empty()
+                && (expandingFace == nullptr || face.furthestDistance > expandingFace->furthestDistance))
+                expandingFace = &face;
+        }
+        
+        if (expandingFace == nullptr)
+            break;
+        
+        const uint32_t eye = expandingFace->furthest;
+        
+        std::unordered_set<uint64_t> visibleEdges;
+        std::vector<uint32_t> orphans;
+        for (HullFace &face : faces)
+        {
+            if (!face.alive || distanceTo(face, points[eye]) <= epsilon)
+                continue;
+            
+            visibleEdges.emplace(edgeKey(face.a, face.b));
+            visibleEdges.emplace(edgeKey(face.b, face.c));
+            visibleEdges.emplace(edgeKey(face.c, face.a));
+            
+            for (const uint32_t index : face.outside)
+            {
+                if (index != eye)
+                    orphans.emplace_back(index);
+            }
+            face.outside.clear();
+            face.alive = false;
+        }
+        
+        // Edges that are only shared with a hidden face form the horizon. Keeping their winding keeps the
+        // new faces pointing outwards.
+        const size_t firstNewFace = faces.size();
+        for (const uint64_t edge : visibleEdges)
+        {
+            const auto from = static_cast<uint32_t>(edge >> 32);
+            const auto to   = static_cast<uint32_t>(edge & 0xffffffff);
+            if (visibleEdges.count(edgeKey(to, from)) == 0)
+                faces.emplace_back(makeFace(points, from, to, eye));
+        }
+        
+        for (const uint32_t index : orphans)
+            assignOutside(faces, firstNewFace, points, index, epsilon);
+    }
+    
+    std::vector<glm::vec3> vertices;
+    std::unordered_set<uint32_t> used;
+    for (const HullFace &face : faces)
+    {
+        if (!face.alive)
+            continue;
+        
+        for (const uint32_t index : { face.a, face.b, face.c })
+        {
+            if (used.emplace(index).second)
+                vertices.emplace_back(points[index]);
+        }
+    }
+    
+    setVertices(vertices);
+}
+
+glm::vec3 ConvexHull::support(const glm::vec3 &direction) const
+{
+    if (mVertexCount == 0)
+        return glm::vec3(0.f);
+    
+    // Each lane keeps its own best so there is no dependency between lanes and the inner loop can be vectorised.
+    std::array<float, laneWidth>    bestDot;
+    std::array<uint32_t, laneWidth> bestIndex;
+    for (uint32_t lane = 0; lane < laneWidth; ++lane)
+    {
+        bestDot[lane]   = -std::numeric_limits<float>::infinity();
+        bestIndex[lane] = lane;
+    }
+    
+    const float *x = mX.data();
+    const float *y = mY.data();
+    const float *z = mZ.data();
+    const auto size = static_cast<uint32_t>(mX.size());
+    for (uint32_t base = 0; base < size; base += laneWidth)
+    {
+        for (uint32_t lane = 0; lane < laneWidth; ++lane)
+        {
+            const uint32_t i = base + lane;
+            const float d = x[i] * direction.x + y[i] * direction.y + z[i] * direction.z;
+            const bool isBetter = d > bestDot[lane];
+            bestDot[lane]   = isBetter ? d : bestDot[lane];
+            bestIndex[lane] = isBetter ? i : bestIndex[lane];
+        }
+    }
+    
+    uint32_t best = 0;
+    for (uint32_t lane = 1; lane < laneWidth; ++lane)
+    {
+        if (bestDot[lane] > bestDot[best])
+            best = lane;
+    }
+    
+    return vertex(bestIndex[best]);
+}
+
+void ConvexHull::setVertices(const std::vector<glm::vec3> &vertices)
+{
+    mVertexCount = static_cast<uint32_t>(vertices.size());
+    if (vertices.empty())
+        return;
+    
+    const uint32_t paddedSize = (mVertexCount + laneWidth - 1) / laneWidth * laneWidth;
+    mX.assign(paddedSize, vertices[0].x);
+    mY.assign(paddedSize, vertices[0].y);
+    mZ.assign(paddedSize, vertices[0].z);
+    
+    glm::vec3 min = vertices[0];
+    glm::vec3 max = vertices[0];
+    for (uint32_t i = 0; i < mVertexCount; ++i)
+    {
+        mX[i] = vertices[i].x;
+        mY[i] = vertices[i].y;
+        mZ[i] = vertices[i].z;
+        min = glm::min(min, vertices[i]);
+        max = glm::max(max, vertices[i]);
+    }
+    
+    mCentre   = (max + min) / 2.f;
+    mHalfSize = (max - min) / 2.f;
+}
@@ -0,0 +1,469 @@
+/**
+ * @file Gjk.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "Gjk.h"
+#include "PhysicsHelpers.h"
+
+namespace gjk
+{
+    namespace
+    {
+        constexpr uint32_t maxIterations    { 64 };
+        constexpr float    tolerance        { 1e-4f };
+        
+        SupportPoint minkowskiSupport(const Shape &a, const Shape &b, const glm::vec3 &direction)
+        {
+            const glm::vec3 onA = a.support(direction);
+            const glm::vec3 onB = b.support(-direction);
+            return { onA - onB, onA, onB };
+        }
+        
+        float length2(const glm::vec3 &value)
+        {
+            return glm::dot(value, value);
+        }
+        
+        /**
+         * @brief The closest point on a simplex to the origin, as weights of the simplex's points.
+         */
+        struct Closest
+        {
+            Simplex                 simplex;
+            std::array<float, 4>    weights { 1.f, 0.f, 0.f, 0.f };
+            glm::vec3               point   { 0.f };
+            bool                    enclosesOrigin { false };
+        };
+        
+        Closest makeClosest(std::initializer_list<SupportPoint> points, std::initializer_list<float> weights)
+        {
+            Closest closest;
+            for (const SupportPoint &point : points)
+                closest.simplex.points[closest.simplex.size++] = point;
+            
+            uint32_t i = 0;
+            for (const float weight : weights)
+            {
+                closest.weights[i] = weight;
+                closest.point += weight * closest.simplex.points[i].point;
+                ++i;
+            }
+            return closest;
+        }
+        
+        Closest closestOnSegment(const SupportPoint &a, const SupportPoint &b)
+        {
+            const glm::vec3 ab = b.point - a.point;
+            const float abLength2 = length2(ab);
+            if (abLength2 <= 0.f)
+                return makeClosest({ a }, { 1.f });
+            
+            const float t = glm::dot(-a.point, ab) / abLength2;
+            if (t <= 0.f)
+                return makeClosest({ a }, { 1.f });
+            if (t >= 1.f)
+                return makeClosest({ b }, { 1.f });
+            return makeClosest({ a, b }, { 1.f - t, t });
+        }
+        
+        /** Ericson, Real-Time Collision Detection, 5.1.5, with the query point at the origin. */
+        Closest closestOnTriangle(const SupportPoint &a, const SupportPoint &b, const SupportPoint &c)
+        {
+            const glm::vec3 ab = b.point - a.point;
+            const glm::vec3 ac = c.point - a.point;
+            
+            const float d1 = glm::dot(ab, -a.point);
+            const float d2 = glm::dot(ac, -a.point);
+            if (d1 <= 0.f && d2 <= 0.f)
+                return makeClosest({ a }, { 1.f });
+            
+            const float d3 = glm::dot(ab, -b.point);
+            const float d4 = glm::dot(ac, -b.point);
+            if (d3 >= 0.f && d4 <= d3)
+                return makeClosest({ b }, { 1.f });
+            
+            const float vc = d1 * d4 - d3 * d2;
+            if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f)
+            {
+                const float v = d1 / (d1 - d3);
+                return makeClosest({ a, b }, { 1.f - v, v });
+            }
+            
+            const float d5 = glm::dot(ab, -c.point);
+            const float d6 = glm::dot(ac, -c.point);
+            if (d6 >= 0.f && d5 <= d6)
+                return makeClosest({ c }, { 1.f });
+            
+            const float vb = d5 * d2 - d1 * d6;
+            if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f)
+            {
+                const float w = d2 / (d2 - d6);
+                return makeClosest({ a, c }, { 1.f - w, w });
+            }
+            
+            const float va = d3 * d6 - d5 * d4;
+            if (va <= 0.f && (d4 - d3) >= 0.f && (d5 - d6) >= 0.f)
+            {
+                const float w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+                return makeClosest({ b, c }, { 1.f - w, w });
+            }
+            
+            const float sum = va + vb + vc;
+            if (sum <= 0.f)
+            {
+                // Degenerate triangle, so one of the edges must hold the closest point.
+                Closest best = closestOnSegment(a, b);
+                for (const Closest &edge : { closestOnSegment(a, c), closestOnSegment(b, c) })
+                {
+                    if (length2(edge.point) < length2(best.point))
+                        best = edge;
+                }
+                return best;
+            }
+            
+            const float v = vb / sum;
+            const float w = vc / sum;
+            return makeClosest({ a, b, c }, { 1.f - v - w, v, w });
+        }
+        
+        Closest closestOnTetrahedron(const SupportPoint &a, const SupportPoint &b, const SupportPoint &c, const SupportPoint &d)
+        {
+            const std::array<std::array<const SupportPoint*, 4>, 4> faces {{
+                { &a, &b, &c, &d },
+                { &a, &c, &d, &b },
+                { &a, &d, &b, &c },
+                { &b, &d, &c, &a } }};
+            
+            Closest best;
+            bool hasBest = false;
+            for (const auto &[p0, p1, p2, opposite] : faces)
+            {
+                const glm::vec3 normal = glm::cross(p1->point - p0->point, p2->point - p0->point);
+                const float originSide   = glm::dot(-p0->point, normal);
+                const float oppositeSide = glm::dot(opposite->point - p0->point, normal);
+                
+                // A flat tetrahedron cannot enclose anything, so all of its faces are tested.
+                const bool isFlat = oppositeSide * oppositeSide <= 1e-12f * length2(normal);
+                if (!isFlat && originSide * oppositeSide >= 0.f)
+                    continue;
+                
+                const Closest closest = closestOnTriangle(*p0, *p1, *p2);
+                if (!hasBest || length2(closest.point) < length2(best.point))
+                {
+                    best = closest;
+                    hasBest = true;
+                }
+            }
+            
+            if (!hasBest)
+            {
+                Closest inside = makeClosest({ a, b, c, d }, { 0.f, 0.f, 0.f, 0.f });
+                inside.enclosesOrigin = true;
+                return inside;
+            }
+            return best;
+        }
+        
+        Closest closestOnSimplex(const Simplex &simplex)
+        {
+            const auto &p = simplex.points;
+            switch (simplex.size)
+            {
+                case 1:
+                    return makeClosest({ p[0] }, { 1.f });
+                case 2:
+                    return closestOnSegment(p[0], p[1]);
+                case 3:
+                    return closestOnTriangle(p[0], p[1], p[2]);
+                default:
+                    return closestOnTetrahedron(p[0], p[1], p[2], p[3]);
+            }
+        }
+        
+        glm::vec3 barycentric(const glm::vec3 &point, const glm::vec3 &a, const glm::vec3 &b, const glm::vec3 &c)
+        {
+            const glm::vec3 v0 = b - a;
+            const glm::vec3 v1 = c - a;
+            const glm::vec3 v2 = point - a;
+            const float d00 = glm::dot(v0, v0);
+            const float d01 = glm::dot(v0, v1);
+            const float d11 = glm::dot(v1, v1);
+            const float d20 = glm::dot(v2, v0);
+            const float d21 = glm::dot(v2, v1);
+            const float denominator = d00 * d11 - d01 * d01;
+            if (denominator == 0.f)
+                return { 1.f, 0.f, 0.f };
+            
+            const float v = (d11 * d20 - d01 * d21) / denominator;
+            const float w = (d00 * d21 - d01 * d20) / denominator;
+            return { 1.f - v - w, v, w };
+        }
+        
+        struct PolytopeFace
+        {
+            uint32_t    a;
+            uint32_t    b;
+            uint32_t    c;
+            glm::vec3   normal;
+            float       distance;
+        };
+        
+        PolytopeFace makeFace(const std::vector<SupportPoint> &vertices, const uint32_t a, const uint32_t b, const uint32_t c)
+        {
+            const glm::vec3 normal = glm::normalize(glm::cross(vertices[b].point - vertices[a].point, vertices[c].point - vertices[a].point));
+            return { a, b, c, normal, glm::dot(normal, vertices[a].point) };
+        }
+        
+        uint64_t edgeKey(const uint32_t from, const uint32_t to)
+        {
+            return (static_cast<uint64_t>(from) << 32) | to;
+        }
+        
+        /**
+         * @brief Epa needs a tetrahedron to start from, but gjk can finish early if the origin lies on a point,
+         * edge or triangle.
+         * @returns False if the Minkowski difference is flat.
+         */
+        bool completeSimplex(const Shape &a, const Shape &b, std::vector<SupportPoint> &vertices)
+        {
+            const auto isNew = [&vertices](const SupportPoint &candidate) {
+                for (const SupportPoint &vertex : vertices)
+                {
+                    if (length2(candidate.point - vertex.point) <= tolerance * tolerance)
+                        return false;
+                }
+                return true;
+            };
+            
+            const std::array<glm::vec3, 6> axes {
+                glm::vec3(1.f, 0.f, 0.f), glm::vec3(-1.f, 0.f, 0.f),
+                glm::vec3(0.f, 1.f, 0.f), glm::vec3(0.f, -1.f, 0.f),
+                glm::vec3(0.f, 0.f, 1.f), glm::vec3(0.f, 0.f, -1.f) };
+            
+            if (vertices.size() == 1)
+            {
+                for (const glm::vec3 &axis : axes)
+                {
+                    const SupportPoint point = minkowskiSupport(a, b, axis);
+                    if (isNew(point))
+                    {
+                        vertices.emplace_back(point);
+                        break;
+                    }
+                }
+            }
+            
+            if (vertices.size() == 2)
+            {
+                const glm::vec3 line = vertices[1].point - vertices[0].point;
+                for (const glm::vec3 &axis : axes)
+                {
+                    const glm::vec3 direction = glm::cross(line, axis);
+                    if (length2(direction) <= 0.f)
+                        continue;
+                    
+                    const SupportPoint point = minkowskiSupport(a, b, direction);
+                    if (isNew(point) && length2(glm::cross(point.point - vertices[0].point, line)) > tolerance * tolerance)
+                    {
+                        vertices.emplace_back(point);
+                        break;
+                    }
+                }
+            }
+            
+            if (vertices.size() == 3)
+            {
+                const glm::vec3 normal = glm::cross(vertices[1].point - vertices[0].point, vertices[2].point - vertices[0].point);
+                for (const glm::vec3 &direction : { normal, -normal })
+                {
+                    const SupportPoint point = minkowskiSupport(a, b, direction);
+                    if (glm::abs(glm::dot(point.point - vertices[0].point, glm::normalize(normal))) > tolerance)
+                    {
+                        vertices.emplace_back(point);
+                        break;
+                    }
+                }
+            }
+            
+            return vertices.size() == 4;
+        }
+    }
+    
+    Shape::Shape(const ConvexHull &hull, const glm::mat4 &modelMatrix) :
+        mHull(&hull), mModelMatrix(modelMatrix), mToLocal(glm::transpose(glm::mat3(modelMatrix)))
+    {
+    }
+    
+    Shape::Shape(const glm::vec3 &halfSize, const glm::mat4 &modelMatrix) :
+        mHalfSize(halfSize), mModelMatrix(modelMatrix), mToLocal(glm::transpose(glm::mat3(modelMatrix)))
+    {
+    }
+    
+    Shape::Shape(const float radius, const glm::mat4 &modelMatrix) :
+        mRadius(radius), mModelMatrix(modelMatrix), mToLocal(glm::transpose(glm::mat3(modelMatrix)))
+    {
+    }
+    
+    glm::vec3 Shape::support(const glm::vec3 &direction) const
+    {
+        // Spheres keep their radius in world space to match the sphere collision checks.
+        if (mRadius > 0.f)
+        {
+            const float length = glm::length(direction);
+            return length > 0.f ? centre() + mRadius * direction / length : centre();
+        }
+        
+        // The support of a transformed shape is the transformed support along the transposed direction.
+        const glm::vec3 localDirection = mToLocal * direction;
+        const glm::vec3 localPoint = mHull != nullptr
+            ? mHull->support(localDirection)
+            : physics::sign3(localDirection) * mHalfSize;
+        
+        return mModelMatrix * glm::vec4(localPoint, 1.f);
+    }
+    
+    DistanceResult distance(const Shape &a, const Shape &b)
+    {
+        DistanceResult result;
+        Simplex &simplex = result.simplex;
+        
+        glm::vec3 direction = a.centre() - b.centre();
+        if (length2(direction) <= 0.f)
+            direction = glm::vec3(1.f, 0.f, 0.f);
+        
+        simplex.points[0] = minkowskiSupport(a, b, -direction);
+        simplex.size = 1;
+        
+        Closest closest = closestOnSimplex(simplex);
+        for (uint32_t iteration = 0; iteration < maxIterations; ++iteration)
+        {
+            const glm::vec3 v = closest.point;
+            const float vLength2 = length2(v);
+            if (closest.enclosesOrigin || vLength2 <= tolerance * tolerance)
+            {
+                result.intersecting = true;
+                break;
+            }
+            
+            const SupportPoint w = minkowskiSupport(a, b, -v);
+            
+            // No further progress towards the origin can be made.
+            if (vLength2 - glm::dot(v, w.point) <= tolerance * vLength2)
+                break;
+            
+            bool isDuplicate = false;
+            for (uint32_t i = 0; i < simplex.size; ++i)
+                isDuplicate |= simplex.points[i].point == w.point;
+            if (isDuplicate)
+                break;
+            
+            simplex.points[simplex.size++] = w;
+            closest = closestOnSimplex(simplex);
+            simplex = closest.simplex;
+        }
+        
+        if (!result.intersecting)
+        {
+            result.distance = glm::length(closest.point);
+            for (uint32_t i = 0; i < closest.simplex.size; ++i)
+            {
+                result.pointA += closest.weights[i] * closest.simplex.points[i].onA;
+                result.pointB += closest.weights[i] * closest.simplex.points[i].onB;
+            }
+        }
+        
+        return result;
+    }
+    
+    bool intersect(const Shape &a, const Shape &b)
+    {
+        return distance(a, b).intersecting;
+    }
+    
+    PenetrationResult penetration(const Shape &a, const Shape &b, const Simplex &simplex)
+    {
+        PenetrationResult result;
+        
+        std::vector<SupportPoint> vertices(simplex.points.begin(), simplex.points.begin() + simplex.size);
+        if (!completeSimplex(a, b, vertices))
+        {
+            const glm::vec3 offset = b.centre() - a.centre();
+            if (length2(offset) > 0.f)
+                result.normal = glm::normalize(offset);
+            result.pointA = vertices[0].onA;
+            result.pointB = vertices[0].onB;
+            return result;
+        }
+        
+        const glm::vec3 centroid = (vertices[0].point + vertices[1].point + vertices[2].point + vertices[3].point) / 4.f;
+        std::vector<PolytopeFace> faces;
+        for (const auto &[i0, i1, i2] : std::array<std::array<uint32_t, 3>, 4> {{ { 0, 1, 2 }, { 0, 3, 1 }, { 1, 3, 2 }, { 2, 3, 0 } }})
+        {
+            PolytopeFace face = makeFace(vertices, i0, i1, i2);
+            if (glm::dot(face.normal, vertices[i0].point - centroid) < 0.f)
+                face = makeFace(vertices, i0, i2, i1);
+            faces.emplace_back(face);
+        }
+        
+        PolytopeFace closestFace = faces[0];
+        for (uint32_t iteration = 0; iteration < maxIterations; ++iteration)
+        {
+            closestFace = *std::min_element(faces.begin(), faces.end(), [](const PolytopeFace &lhs, const PolytopeFace &rhs) {
+                return lhs.distance < rhs.distance;
+            });
+            
+            const SupportPoint w = minkowskiSupport(a, b, closestFace.normal);
+            if (glm::dot(w.point, closestFace.normal) - closestFace.distance <= tolerance)
+                break;
+            
+            const auto newIndex = static_cast<uint32_t>(vertices.size());
+            vertices.emplace_back(w);
+            
+            // Kept sorted rather than hashed so that the horizon is always rebuilt in the same order.
+            std::vector<uint64_t> removedEdges;
+            std::vector<PolytopeFace> keptFaces;
+            for (const PolytopeFace &face : faces)
+            {
+                if (glm::dot(face.normal, w.point - vertices[face.a].point) > 0.f)
+                {
+                    removedEdges.emplace_back(edgeKey(face.a, face.b));
+                    removedEdges.emplace_back(edgeKey(face.b, face.c));
+                    removedEdges.emplace_back(edgeKey(face.c, face.a));
+                }
+                else
+                {
+                    keptFaces.emplace_back(face);
+                }
+            }
+            
+            if (removedEdges.empty())
+                break;
+            std::sort(removedEdges.begin(), removedEdges.end());
+            
+            // The horizon is made from the edges of removed faces that are not shared with another removed face.
+            for (const uint64_t edge : removedEdges)
+            {
+                const auto from = static_cast<uint32_t>(edge >> 32);
+                const auto to   = static_cast<uint32_t>(edge & 0xffffffff);
+                if (!std::binary_search(removedEdges.begin(), removedEdges.end(), edgeKey(to, from)))
+                    keptFaces.emplace_back(makeFace(vertices, from, to, newIndex));
+            }
+            
+            faces = std::move(keptFaces);
+        }
+        
+        const SupportPoint &p0 = vertices[closestFace.a];
+        const SupportPoint &p1 = vertices[closestFace.b];
+        const SupportPoint &p2 = vertices[closestFace.c];
+        const glm::vec3 weights = barycentric(closestFace.normal * closestFace.distance, p0.point, p1.point, p2.point);
+        
+        result.normal = closestFace.normal;
+        result.depth  = closestFace.distance;
+        result.pointA = weights.x * p0.onA + weights.y * p1.onA + weights.z * p2.onA;
+        result.pointB = weights.x * p0.onB + weights.y * p1.onB + weights.z * p2.onB;
+        return result;
+    }
+}
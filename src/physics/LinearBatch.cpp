@@ -0,0 +1,169 @@
+/**
+ * @file LinearBatch.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "LinearBatch.h"
+#include "physics/components/Physics.h"
+#include "Components.h"
+#include "PhysicsSystems.h"
+#include "Timers.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+void LinearBatch::clear()
+{
+    for (std::vector<float> *array : {
+        &mPositionX, &mPositionY, &mPositionZ, &mMomentumX, &mMomentumY, &mMomentumZ,
+        &mForceX, &mForceY, &mForceZ, &mInverseMass })
+    {
+        array->clear();
+    }
+    mSize = 0;
+}
+
+void LinearBatch::gather(const DynamicObject &dynamicObject, const Position &position)
+{
+    const auto &[force, mass, momentum] = dynamicObject;
+    
+    mPositionX.emplace_back(position.value.x);
+    mPositionY.emplace_back(position.value.y);
+    mPositionZ.emplace_back(position.value.z);
+    mMomentumX.emplace_back(momentum.x);
+    mMomentumY.emplace_back(momentum.y);
+    mMomentumZ.emplace_back(momentum.z);
+    mForceX.emplace_back(force.x);
+    mForceY.emplace_back(force.y);
+    mForceZ.emplace_back(force.z);
+    mInverseMass.emplace_back(1.f / mass);
+    ++mSize;
+}
+
+void LinearBatch::integrate(const float deltaTime, const LinearBatchWeights &weights)
+{
+    uint32_t first = 0;
+#ifdef __AVX2__
+    const __m256 momentumStep = _mm256_set1_ps(deltaTime * weights.momentum);
+    const __m256 forceStep = _mm256_set1_ps(deltaTime * deltaTime * weights.force);
+    
+    // Position uses the momentum from before the step, matching physics::rungeKutta. The force is cleared by
+    // scatter(), so it is never stored back here.
+    const auto integrateAxis = [&](float *position, float *momentum, const float *force, const __m256 inverseMass) {
+        __m256 x = _mm256_loadu_ps(position);
+        __m256 p = _mm256_loadu_ps(momentum);
+        const __m256 f = _mm256_loadu_ps(force);
+        
+        const __m256 displacement = _mm256_add_ps(_mm256_mul_ps(p, momentumStep), _mm256_mul_ps(f, forceStep));
+        x = _mm256_add_ps(x, _mm256_mul_ps(displacement, inverseMass));
+        p = _mm256_add_ps(p, _mm256_mul_ps(f, momentumStep));
+        
+        _mm256_storeu_ps(position, x);
+        _mm256_storeu_ps(momentum, p);
+    };
+    
+    for (; first + laneWidth <= mSize; first += laneWidth)
+    {
+        const __m256 inverseMass = _mm256_loadu_ps(&mInverseMass[first]);
+        integrateAxis(&mPositionX[first], &mMomentumX[first], &mForceX[first], inverseMass);
+        integrateAxis(&mPositionY[first], &mMomentumY[first], &mForceY[first], inverseMass);
+        integrateAxis(&mPositionZ[first], &mMomentumZ[first], &mForceZ[first], inverseMass);
+    }
+#endif
+    integrateRange(first, mSize, deltaTime, weights);
+}
+
+void LinearBatch::integrateScalar(const float deltaTime, const LinearBatchWeights &weights)
+{
+    integrateRange(0, mSize, deltaTime, weights);
+}
+
+void LinearBatch::integrateRange(
+    const uint32_t first, const uint32_t last, const float deltaTime, const LinearBatchWeights &weights)
+{
+    const float momentumStep = deltaTime * weights.momentum;
+    const float forceStep = deltaTime * deltaTime * weights.force;
+    
+    for (uint32_t i = first; i < last; ++i)
+    {
+        const float inverseMass = mInverseMass[i];
+        
+        mPositionX[i] += (mMomentumX[i] * momentumStep + mForceX[i] * forceStep) * inverseMass;
+        mPositionY[i] += (mMomentumY[i] * momentumStep + mForceY[i] * forceStep) * inverseMass;
+        mPositionZ[i] += (mMomentumZ[i] * momentumStep + mForceZ[i] * forceStep) * inverseMass;
+        
+        mMomentumX[i] += mForceX[i] * momentumStep;
+        mMomentumY[i] += mForceY[i] * momentumStep;
+        mMomentumZ[i] += mForceZ[i] * momentumStep;
+    }
+}
+
+void LinearBatch::scatter(const uint32_t index, DynamicObject &dynamicObject, Velocity &velocity, Position &position) const
+{
+    position.value          = glm::vec3(mPositionX[index], mPositionY[index], mPositionZ[index]);
+    dynamicObject.momentum  = glm::vec3(mMomentumX[index], mMomentumY[index], mMomentumZ[index]);
+    velocity.value          = dynamicObject.momentum * mInverseMass[index];
+    dynamicObject.force     = glm::vec3(0.f);
+}
+
+namespace physics
+{
+    namespace
+    {
+        struct BenchmarkBody
+        {
+            DynamicObject   dynamicObject;
+            Velocity        velocity;
+            Position        position;
+        };
+        
+        std::vector<BenchmarkBody> makeBenchmarkBodies(const uint32_t bodyCount)
+        {
+            std::vector<BenchmarkBody> bodies(bodyCount);
+            for (uint32_t i = 0; i < bodyCount; ++i)
+            {
+                bodies[i].dynamicObject = DynamicObject { glm::vec3(0.f, -981.f, 0.f), 100.f + static_cast<float>(i % 7) };
+                bodies[i].position.value = glm::vec3(static_cast<float>(i % 100), 5.f, static_cast<float>(i / 100));
+            }
+            return bodies;
+        }
+    }
+    
+    LinearBatchBenchmark benchmarkLinearBatch(const uint32_t bodyCount, const uint32_t steps)
+    {
+        const float fixedTime = timers::fixedTime<float>();
+        LinearBatchBenchmark result { bodyCount };
+        
+        std::vector<BenchmarkBody> bodies = makeBenchmarkBodies(bodyCount);
+        result.perEntityBodiesPerMs = timers::itemsPerMs(bodyCount, steps, [&]() {
+            for (auto &[dynamicObject, velocity, position] : bodies)
+                LinearEulerMethod::integrate(dynamicObject, velocity, position);
+        });
+        
+        LinearBatch batch;
+        const auto batchStep = [&](const bool useSimd) {
+            batch.clear();
+            for (const auto &[dynamicObject, velocity, position] : bodies)
+                batch.gather(dynamicObject, position);
+            
+            if (useSimd)
+                batch.integrate(fixedTime);
+            else
+                batch.integrateScalar(fixedTime);
+            
+            for (uint32_t i = 0; i < bodyCount; ++i)
+                batch.scatter(i, bodies[i].dynamicObject, bodies[i].velocity, bodies[i].position);
+        };
+        
+        bodies = makeBenchmarkBodies(bodyCount);
+        result.scalarBatchBodiesPerMs = timers::itemsPerMs(bodyCount, steps, [&]() { batchStep(false); });
+        
+        bodies = makeBenchmarkBodies(bodyCount);
+        result.simdBatchBodiesPerMs = timers::itemsPerMs(bodyCount, steps, [&]() { batchStep(true); });
+        
+        return result;
+    }
+}
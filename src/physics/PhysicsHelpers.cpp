@@ -34,6 +34,45 @@ namespace physics
             modelMatrix * glm::vec4(-halfSize.x, -halfSize.y, +halfSize.z, 1.f),
         };
     }
+    
+    std::pair<glm::vec3, glm::vec3> axisAlignedBounds(const glm::mat4 &modelMatrix, const glm::vec3 &centre, const glm::vec3 &halfSize)
+    {
+        const glm::vec3 worldCentre = modelMatrix * glm::vec4(centre, 1.f);
+        
+        // Each world axis is reached by the absolute sum of the box's transformed axes.
+        glm::vec3 worldHalfSize(0.f);
+        for (int axis = 0; axis < 3; ++axis)
+            worldHalfSize += glm::abs(glm::vec3(modelMatrix[axis])) * halfSize[axis];
+        
+        return { worldCentre, worldHalfSize };
+    }
+    
+    glm::quat integrateOrientation(const glm::quat &orientation, const glm::vec3 &angularVelocity, const float time)
+    {
+        const float speed = glm::length(angularVelocity);
+        if (speed <= 0.f)
+            return orientation;
+        
+        // Normalising here only removes rounding error. The exponential map itself never changes the length.
+        return glm::normalize(glm::angleAxis(speed * time, angularVelocity / speed) * orientation);
+    }
+    
+    glm::vec3 solveGyroscopic(const glm::quat &orientation, const glm::mat3 &bodyInertia, const glm::vec3 &angularVelocity, const float time)
+    {
+        const auto skew = [](const glm::vec3 &v) {
+            return glm::mat3(
+                0.f,  v.z, -v.y,
+                -v.z, 0.f,  v.x,
+                v.y, -v.x,  0.f);
+        };
+        
+        const glm::vec3 omega       = glm::conjugate(orientation) * angularVelocity;
+        const glm::vec3 momentum    = bodyInertia * omega;
+        const glm::vec3 residual    = time * glm::cross(omega, momentum);
+        const glm::mat3 jacobian    = bodyInertia + time * (skew(omega) * bodyInertia - skew(momentum));
+        
+        return orientation * (omega - glm::inverse(jacobian) * residual);
+    }
 }
 
 namespace sdf
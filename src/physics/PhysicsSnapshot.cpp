@@ -0,0 +1,245 @@
+/**
+ * @file PhysicsSnapshot.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "PhysicsSnapshot.h"
+#include "PhysicsWorld.h"
+#include "Physics.h"
+#include "Components.h"
+#include "UniformComponents.h"
+#include "BoundingVolumes.h"
+#include "TransformHierarchy.h"
+#include "PhysicsSystems.h"
+#include "Timers.h"
+
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    template<typename... TComponents>
+    struct ComponentList
+    {
+        static constexpr std::size_t maxSize { (sizeof(TComponents) + ...) };
+    };
+    
+    /**
+     * Components that are always in the default channel. Each one has a bit in the mask in this order. Scale is left
+     * out as physics never changes it.
+     */
+    using SnapshotComponents = ComponentList<Position, Rotation, Velocity, AngularObject, AngularVelocity, Torque, AdaptiveStep>;
+    using Mask = uint16_t;
+    
+    constexpr Mask transformBits     { 0b11 };
+    constexpr Mask dynamicObjectBit  { 1 << 7 };
+    constexpr Mask colliderBit       { 1 << 8 };
+    
+    enum class ColliderShape : uint32_t { Sphere, Box, ConvexHull };
+    
+    /** The part of a collider that can change. The hull of a convex hull is shared and never changes. */
+    struct ColliderState
+    {
+        ColliderShape   shape   { ColliderShape::Sphere };
+        glm::vec3       size    { 0.f };
+    };
+    
+    constexpr std::size_t maxBodySize {
+        sizeof(Mask) + SnapshotComponents::maxSize + sizeof(DynamicObject) + sizeof(ColliderState) };
+    
+    template<typename T>
+    void write(std::byte *data, std::size_t &offset, const T &value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Snapshot components must be trivially copyable.");
+        std::memcpy(data + offset, &value, sizeof(T));
+        offset += sizeof(T);
+    }
+    
+    template<typename T>
+    void read(const std::byte *data, std::size_t &offset, T &value)
+    {
+        std::memcpy(&value, data + offset, sizeof(T));
+        offset += sizeof(T);
+    }
+    
+    template<typename... TComponents>
+    void captureComponents(ComponentList<TComponents...>, ecs::Core &ecs, const Entity entity, std::byte *data, std::size_t &offset, Mask &mask)
+    {
+        Mask bit = 1;
+        ([&]() {
+            if (ecs.hasComponent<TComponents>(entity))
+            {
+                mask |= bit;
+                write(data, offset, ecs.getComponent<TComponents>(entity));
+            }
+            bit <<= 1;
+        }(), ...);
+    }
+    
+    template<typename... TComponents>
+    void restoreComponents(ComponentList<TComponents...>, ecs::Core &ecs, const Entity entity, const std::byte *data, std::size_t &offset, const Mask mask)
+    {
+        Mask bit = 1;
+        ([&]() {
+            if (mask & bit)
+                read(data, offset, ecs.getComponent<TComponents>(entity));
+            bit <<= 1;
+        }(), ...);
+    }
+    
+    DynamicObject *findDynamicObject(ecs::Core &ecs, const SnapshotBody &body)
+    {
+        if (body.dynamicType.has_value())
+            return &ecs.getComponent<DynamicObject>(body.entity, body.dynamicType.value());
+        if (ecs.hasComponent<DynamicObject>(body.entity))
+            return &ecs.getComponent<DynamicObject>(body.entity);
+        return nullptr;
+    }
+    
+    std::optional<ColliderState> captureCollider(const BoundingVolume &boundingVolume)
+    {
+        if (const auto *sphere = dynamic_cast<const BoundingSphere*>(&boundingVolume))
+            return ColliderState { ColliderShape::Sphere, glm::vec3(sphere->radius) };
+        if (const auto *box = dynamic_cast<const BoundingBox*>(&boundingVolume))
+            return ColliderState { ColliderShape::Box, box->halfSize };
+        if (dynamic_cast<const BoundingConvexHull*>(&boundingVolume))
+            return ColliderState { ColliderShape::ConvexHull };
+        return std::nullopt;
+    }
+    
+    void restoreCollider(BoundingVolume &boundingVolume, const ColliderState &state)
+    {
+        if (state.shape == ColliderShape::Sphere)
+            static_cast<BoundingSphere&>(boundingVolume).radius = state.size.x;
+        else if (state.shape == ColliderShape::Box)
+            static_cast<BoundingBox&>(boundingVolume).halfSize = state.size;
+    }
+}
+
+void PhysicsSnapshot::capture(ecs::Core &ecs, const std::vector<SnapshotBody> &bodies, const uint64_t tick)
+{
+    mTick = tick;
+    
+    // Sized for the worst case up front and trimmed afterwards, so the buffer never reallocates mid capture.
+    mData.resize(bodies.size() * maxBodySize);
+    std::byte *data = mData.data();
+    std::size_t offset = 0;
+    
+    for (const SnapshotBody &body : bodies)
+    {
+        const std::size_t maskOffset = offset;
+        offset += sizeof(Mask);
+        Mask mask = 0;
+        captureComponents(SnapshotComponents(), ecs, body.entity, data, offset, mask);
+        
+        if (const DynamicObject *dynamicObject = findDynamicObject(ecs, body))
+        {
+            mask |= dynamicObjectBit;
+            write(data, offset, *dynamicObject);
+        }
+        
+        if (ecs.hasComponent<std::shared_ptr<BoundingVolume>>(body.entity))
+        {
+            if (const auto collider = captureCollider(*ecs.getComponent<std::shared_ptr<BoundingVolume>>(body.entity)))
+            {
+                mask |= colliderBit;
+                write(data, offset, collider.value());
+            }
+        }
+        
+        std::memcpy(data + maskOffset, &mask, sizeof(Mask));
+    }
+    
+    mData.resize(offset);
+}
+
+void PhysicsSnapshot::restore(ecs::Core &ecs, const std::vector<SnapshotBody> &bodies, TransformHierarchy &hierarchy) const
+{
+    const std::byte *data = mData.data();
+    std::size_t offset = 0;
+    
+    for (const SnapshotBody &body : bodies)
+    {
+        Mask mask = 0;
+        read(data, offset, mask);
+        restoreComponents(SnapshotComponents(), ecs, body.entity, data, offset, mask);
+        
+        if (mask & dynamicObjectBit)
+            read(data, offset, *findDynamicObject(ecs, body));
+        
+        if (mask & colliderBit)
+        {
+            ColliderState collider;
+            read(data, offset, collider);
+            restoreCollider(*ecs.getComponent<std::shared_ptr<BoundingVolume>>(body.entity), collider);
+        }
+        
+        if ((mask & transformBits) && ecs.hasComponent<TransformNode>(body.entity))
+        {
+            hierarchy.setLocal(ecs.getComponent<TransformNode>(body.entity), Transform {
+                ecs.getComponent<Position>(body.entity).value,
+                ecs.getComponent<Rotation>(body.entity).value,
+                ecs.getComponent<Scale>(body.entity).value });
+        }
+    }
+    
+    hierarchy.update();
+}
+
+bool PhysicsSnapshot::operator==(const PhysicsSnapshot &other) const
+{
+    return mTick == other.mTick && mData == other.mData;
+}
+
+namespace physics
+{
+    SnapshotBenchmark benchmarkSnapshot(const uint32_t bodyCount, const uint32_t steps)
+    {
+        SnapshotBenchmark result { bodyCount };
+        
+        {
+            PhysicsWorld world;
+            for (uint32_t i = 0; i < bodyCount; ++i)
+                world.createSphere(glm::vec3(static_cast<float>(i % 100), 5.f, static_cast<float>(i / 100)));
+            
+            PhysicsSnapshot snapshot = world.snapshot();
+            result.bytes = snapshot.bytes();
+            result.captureMs = timers::measure([&]() {
+                for (uint32_t i = 0; i < steps; ++i)
+                    snapshot = world.snapshot();
+            }) / steps;
+            result.restoreMs = timers::measure([&]() {
+                for (uint32_t i = 0; i < steps; ++i)
+                    world.restore(snapshot);
+            }) / steps;
+        }
+        
+        // A few balls falling onto the floor, pushed sideways now and then, so the replay goes through collisions.
+        PhysicsWorld world;
+        world.createFloor();
+        world.createCollisionSystems();
+        const Component tag = world.ecs().create<DynamicObject>();
+        for (uint32_t i = 0; i < 16; ++i)
+            world.createSphere(glm::vec3(static_cast<float>(i % 4) * 3.f, 3.f + static_cast<float>(i / 4), 0.f), tag);
+        world.ecs().createSystem<Gravity>({ tag });
+        world.ecs().createSystem<LinearRk4>({ tag });
+        
+        constexpr uint32_t replayTicks { 300 };
+        world.startRecording();
+        for (uint32_t tick = 0; tick < replayTicks; ++tick)
+        {
+            if (tick % 25 == 0)
+                world.applyForce(1 + tick / 25 % 16, glm::vec3(5000.f, 0.f, 0.f));
+            world.step();
+        }
+        const PhysicsRecording recording = world.stopRecording();
+        const PhysicsSnapshot original = world.snapshot();
+        
+        world.replay(recording);
+        result.replayMatches = world.snapshot() == original;
+        
+        return result;
+    }
+}
@@ -14,146 +14,215 @@
 
 Gravity::Gravity()
 {
-    mEntities.forEach([this](DynamicObject &dynamicObject) {
-        auto &[force, mass, _] = dynamicObject;
-        force.y -= mass * gravitationalConstant;
+    mEntities.forEach([](DynamicObject &dynamicObject) {
+        apply(dynamicObject);
     });
     scheduleFor(ecs::FixedUpdate);
 }
 
-LinearEulerMethod::LinearEulerMethod()
+void Gravity::apply(DynamicObject &dynamicObject)
 {
-    mEntities.forEach([](DynamicObject &dynamicObject, Velocity &velocity, Transform &transform) {
-        auto &[force, mass, momentum] = dynamicObject;
-        const float fixedTime = timers::fixedTime<float>();
-    
-        // Update the position first. Collision responses can update auxiliary values.
-        transform.position += velocity.value * fixedTime;
-        
-        // Calculate the forces for the next frame.
-        momentum        += force * fixedTime;
-        velocity.value  = momentum / mass;
-        force           = glm::vec3(0.f);  // Reset the forces for the next frame.
+    auto &[force, mass, _] = dynamicObject;
+    force.y -= mass * gravitationalConstant;
+}
+
+LinearBatchGather::LinearBatchGather(std::shared_ptr<LinearBatch> batch)
+    : mBatch(std::move(batch))
+{
+    mEntities.forEach([this](const DynamicObject &dynamicObject, const Velocity &, const Position &position) {
+        mBatch->gather(dynamicObject, position);
     });
     scheduleFor(ecs::FixedUpdate);
 }
 
+void LinearBatchGather::onUpdate()
+{
+    mBatch->clear();
+}
+
 LinearKinematicSystem::LinearKinematicSystem()
 {
-    mEntities.forEach([](const Kinematic &kinematic, const Velocity &velocity, Transform &transform) {
-        transform.position += velocity.value * timers::fixedTime<float>();
+    mEntities.forEach([](const Kinematic &kinematic, const Velocity &velocity, Position &position) {
+        integrate(kinematic, velocity, position, timers::fixedTime<float>());
     });
     scheduleFor(ecs::FixedUpdate);
 }
 
-AngularEulerMethod::AngularEulerMethod()
+void LinearKinematicSystem::integrate(
+    const Kinematic &, const Velocity &velocity, Position &position, const float deltaTime)
 {
-    mEntities.forEach([](Torque &torque, AngularObject &angularObject, AngularVelocity &angularVelocity, Transform &transform) {
-        angularObject.angularMomentum += torque.tau * timers::fixedTime<float>();
-        
-        glm::mat3 rotation = glm::mat3_cast(transform.rotation);
-        angularObject.inverseInertia = rotation * angularObject.inverseBodyInertia * glm::transpose(rotation);
-        
-        angularVelocity.omega = angularObject.inverseInertia * angularObject.angularMomentum;
-        
-        const glm::vec3 &omega = angularVelocity.omega;
-        const glm::mat3 omegaStar = glm::mat3(
-            0.f,      -omega.z, omega.y,
-            omega.z,  0.f,      -omega.x,
-            -omega.y, omega.x,  0.f);
-
-        rotation = rotation + omegaStar * rotation * timers::fixedTime<float>();
+    position.value += velocity.value * deltaTime;
+}
 
-        transform.rotation = glm::normalize(glm::quat_cast(rotation));
-        
-        torque.tau = glm::vec3(0.f);
+AngularEulerMethod::AngularEulerMethod()
+{
+    mEntities.forEach([](Torque &torque, AngularObject &angularObject, AngularVelocity &angularVelocity, Rotation &rotation) {
+        integrate(torque, angularObject, angularVelocity, rotation);
     });
     scheduleFor(ecs::FixedUpdate);
 }
 
-LinearRk4::LinearRk4()
+void AngularEulerMethod::integrate(Torque &torque, AngularObject &angularObject, AngularVelocity &angularVelocity, Rotation &rotation)
 {
-    mEntities.forEach([](DynamicObject &dynamicObject, Velocity &velocity, Transform &transform) {
-        auto &[force, mass, momentum] = dynamicObject;
-        const float fixedTime = timers::fixedTime<float>();
-        
-        // This is added on before as collision reactions can impact the velocity.
-        // This makes everything slightly more stable as a tiny amount of energy is added rather than removed.
-        // Should ideally be moved to after rk4 has happened.
-        transform.position += velocity.value * fixedTime;
-        
-        const glm::vec3 k1 = physics::calculateMomentum(fixedTime,           force);
-        const glm::vec3 k2 = physics::calculateMomentum(0.5f * fixedTime,    force + 0.5f * fixedTime * k1);
-        const glm::vec3 k3 = physics::calculateMomentum(0.5f * fixedTime,    force + 0.5f * fixedTime * k2);
-        const glm::vec3 k4 = physics::calculateMomentum(fixedTime,           force + fixedTime * k3);
-        
-        // Weighted average of each K value to determine momentum.
-        momentum += (k1 + 2.f * k2 + 2.f * k3 + k4) / 6.f;
-        velocity.value = momentum / mass;
+    angularObject.angularMomentum += torque.tau * timers::fixedTime<float>();
+    
+    glm::mat3 rotationMatrix = glm::mat3_cast(rotation.value);
+    angularObject.inverseInertia = rotationMatrix * angularObject.inverseBodyInertia * glm::transpose(rotationMatrix);
+    
+    angularVelocity.omega = angularObject.inverseInertia * angularObject.angularMomentum;
+    
+    const glm::vec3 &omega = angularVelocity.omega;
+    const glm::mat3 omegaStar = glm::mat3(
+        0.f,      -omega.z, omega.y,
+        omega.z,  0.f,      -omega.x,
+        -omega.y, omega.x,  0.f);
     
-        force = glm::vec3(0.f);
+    rotationMatrix = rotationMatrix + omegaStar * rotationMatrix * timers::fixedTime<float>();
+    
+    rotation.value = glm::normalize(glm::quat_cast(rotationMatrix));
+    
+    torque.tau = glm::vec3(0.f);
+}
+
+AngularQuaternionMethod::AngularQuaternionMethod(const bool gyroscopic)
+    : mGyroscopic(gyroscopic)
+{
+    mEntities.forEach([this](Torque &torque, AngularObject &angularObject, AngularVelocity &angularVelocity, Rotation &rotation) {
+        integrate(torque, angularObject, angularVelocity, rotation.value, mGyroscopic);
     });
     scheduleFor(ecs::FixedUpdate);
 }
 
-LinearRk2::LinearRk2()
+void AngularQuaternionMethod::integrate(
+    Torque &torque, AngularObject &angularObject, AngularVelocity &angularVelocity,
+    glm::quat &rotation, const bool gyroscopic)
 {
-    mEntities.forEach([](DynamicObject &dynamicObject, Velocity &velocity, Transform &transform) {
-        auto &[force, mass, momentum] = dynamicObject;
-        const float fixedTime = timers::fixedTime<float>();
-    
-        // This is added on before as collision reactions can impact the velocity.
-        // This makes everything slightly more stable as a tiny amount of energy is added rather than removed.
-        // Should ideally be moved to after rk2 has happened.
-        transform.position += velocity.value * fixedTime;
-        
-        const glm::vec3 k1 = physics::calculateMomentum(fixedTime, force);
-        const glm::vec3 k2 = physics::calculateMomentum(0.5f * fixedTime, force + 0.5f * fixedTime * k1);
-        
-        momentum += (k1 + k2) / 2.f;
-        velocity.value = momentum / mass;
-        
-        force = glm::vec3(0.f);
+    const float fixedTime = timers::fixedTime<float>();
+    const auto updateInertia = [&]() {
+        const glm::mat3 matrix = glm::mat3_cast(rotation);
+        angularObject.inverseInertia = matrix * angularObject.inverseBodyInertia * glm::transpose(matrix);
+        angularObject.inertiaRotation = rotation;
+    };
+    
+    // The rotation can also be changed outside of physics (e.g., by the editor).
+    if (angularObject.inertiaRotation != rotation)
+        updateInertia();
+    
+    angularObject.angularMomentum += torque.tau * fixedTime;
+    angularVelocity.omega = angularObject.inverseInertia * angularObject.angularMomentum;
+    torque.tau = glm::vec3(0.f);
+    
+    if (angularVelocity.omega == glm::vec3(0.f))
+        return;
+    
+    if (gyroscopic)
+    {
+        angularVelocity.omega = physics::solveGyroscopic(
+            rotation, glm::inverse(angularObject.inverseBodyInertia), angularVelocity.omega, fixedTime);
+        angularObject.angularMomentum = glm::inverse(angularObject.inverseInertia) * angularVelocity.omega;
+    }
+    
+    rotation = physics::integrateOrientation(rotation, angularVelocity.omega, fixedTime);
+    updateInertia();
+}
+
+LinearRkN::LinearRkN(const uint32_t degree)
+    : mBinomials(binomials(degree))
+{
+    for (const float binomial : mBinomials)
+        mSum += 1.f / binomial;
+    
+    mEntities.forEach([this](DynamicObject &dynamicObject, Velocity &velocity, Position &position) {
+        integrate(mBinomials, mSum, dynamicObject, velocity, position);
     });
     scheduleFor(ecs::FixedUpdate);
 }
 
-LinearRk::LinearRk(const uint32_t degree)
-    : mDegree(degree)
+std::vector<float> LinearRkN::binomials(const uint32_t degree)
 {
-    float a = static_cast<float>(mDegree) - 1.f;
+    std::vector<float> binomials;
+    float a = static_cast<float>(degree) - 1.f;
     float b = 1.f;
     float value = 1.f;
-    for (int i = 0; i < mDegree; ++i)
+    for (int i = 0; i < degree; ++i)
     {
-        mBinomials.emplace_back(1.f / value);
-        mSum += value;
+        binomials.emplace_back(1.f / value);
         value *= a--;
         value /= b++;
     }
+    return binomials;
+}
+
+void LinearRkN::integrate(
+    const std::vector<float> &binomials, const float sum,
+    DynamicObject &dynamicObject, Velocity &velocity, Position &position)
+{
+    auto &[force, mass, momentum] = dynamicObject;
+    const float fixedTime = timers::fixedTime<float>();
     
-    mEntities.forEach([this](DynamicObject &dynamicObject, Velocity &velocity, Transform &transform) {
-        auto &[force, mass, momentum] = dynamicObject;
-        const float fixedTime = timers::fixedTime<float>();
+    // This is added on before as collision reactions can impact the velocity.
+    // This makes everything slightly more stable as a tiny amount of energy is added rather than removed.
+    // Should ideally be moved to after rk(n) has happened.
+    position.value += velocity.value * fixedTime;
     
-        // This is added on before as collision reactions can impact the velocity.
-        // This makes everything slightly more stable as a tiny amount of energy is added rather than removed.
-        // Should ideally be moved to after rk(n) has happened.
-        transform.position += velocity.value * fixedTime;
-        
-        glm::vec3 momentumDelta = glm::vec3(0.f);
-        glm::vec3 previousK = glm::vec3(0.f);
-        for (const float binomial : mBinomials)
+    glm::vec3 momentumDelta = glm::vec3(0.f);
+    glm::vec3 previousK = glm::vec3(0.f);
+    for (const float binomial : binomials)
+    {
+        const glm::vec3 k = physics::calculateMomentum(binomial * fixedTime, force + binomial * fixedTime * previousK);
+        momentumDelta += (1.f / binomial) * k;
+        previousK = k;
+    }
+    
+    momentum += momentumDelta / sum;
+    velocity.value = momentum / mass;
+    
+    force = glm::vec3(0.f);
+}
+
+namespace physics
+{
+    RungeKuttaBenchmark benchmarkRungeKutta(const uint32_t bodyCount, const uint32_t steps)
+    {
+        struct Body
         {
-            const glm::vec3 k = physics::calculateMomentum(binomial * fixedTime, force + binomial * fixedTime * previousK);
-            momentumDelta += (1.f / binomial) * k;
-            previousK = k;
-        }
+            DynamicObject   dynamicObject;
+            Velocity        velocity;
+            Position        position;
+        };
         
-        momentum += momentumDelta / mSum;
-        velocity.value = momentum / mass;
+        const auto makeBodies = [bodyCount]() {
+            std::vector<Body> bodies(bodyCount);
+            for (uint32_t i = 0; i < bodyCount; ++i)
+                bodies[i].position.value = glm::vec3(static_cast<float>(i % 4) * 4.f - 6.f, 5.f, 0.f);
+            return bodies;
+        };
         
-        force = glm::vec3(0.f);
-    });
-    scheduleFor(ecs::FixedUpdate);
+        // Matches the ode demo, where each ball has a mass of 100 and is only acted on by gravity.
+        const auto run = [&](auto &&integrate) {
+            std::vector<Body> bodies = makeBodies();
+            return timers::itemsPerMs(bodyCount, steps, [&]() {
+                for (auto &[dynamicObject, velocity, position] : bodies)
+                {
+                    dynamicObject.mass = 100.f;
+                    dynamicObject.force.y -= dynamicObject.mass * 9.81f;
+                    integrate(dynamicObject, velocity, position);
+                }
+            });
+        };
+        
+        const std::vector<float> binomials = LinearRkN::binomials(4);
+        float sum = 0.f;
+        for (const float binomial : binomials)
+            sum += 1.f / binomial;
+        
+        RungeKuttaBenchmark result { bodyCount };
+        result.templatedBodiesPerMs = run([](DynamicObject &dynamicObject, Velocity &velocity, Position &position) {
+            LinearRk4::integrate(dynamicObject, velocity, position);
+        });
+        result.runtimeBodiesPerMs = run([&](DynamicObject &dynamicObject, Velocity &velocity, Position &position) {
+            LinearRkN::integrate(binomials, sum, dynamicObject, velocity, position);
+        });
+        return result;
+    }
 }
@@ -0,0 +1,147 @@
+/**
+ * @file PhysicsWorld.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "PhysicsWorld.h"
+#include "Components.h"
+#include "UniformComponents.h"
+#include "ModelMatrixUpdater.h"
+#include "TreeBuilder.h"
+#include "CollisionDetection.h"
+#include "Physics.h"
+#include "BoundingVolumes.h"
+
+PhysicsWorld::PhysicsWorld()
+{
+    mEcs.createSystem<ModelMatrixUpdater>(mHierarchy);
+    mEcs.createSystem<TransformHierarchyUpdater>(mHierarchy, ecs::Update);
+}
+
+Entity PhysicsWorld::createBody(const glm::vec3 &position)
+{
+    const Transform transform { position };
+    
+    Entity entity = mEcs.create();
+    mEcs.add(entity, Position { transform.position });
+    mEcs.add(entity, Rotation { transform.rotation });
+    mEcs.add(entity, Scale { transform.scale });
+    mEcs.add(entity, mHierarchy->create(transform));
+    mBodies.push_back({ entity, std::nullopt });
+    return entity;
+}
+
+Entity PhysicsWorld::createSphere(const glm::vec3 &position, const float mass, const float bounciness, const float radius)
+{
+    Entity entity = createBody(position);
+    mCollisionResponse.makePhysicsObject(entity, glm::vec3(0.f), mass, bounciness);
+    mCollisionResponse.makeBoundingSphere(entity, true, radius);
+    return entity;
+}
+
+Entity PhysicsWorld::createSphere(const glm::vec3 &position, const Component type, const float mass, const float bounciness)
+{
+    Entity entity = createBody(position);
+    mBodies.back().dynamicType = type;
+    mEcs.add(entity, type, DynamicObject { glm::vec3(0.f), mass });
+    mEcs.add(entity, Velocity());
+    mEcs.add(entity, PhysicsMaterial { bounciness });
+    std::shared_ptr<BoundingVolume> boundingVolume = std::make_shared<BoundingSphere>(entity, 1.f);
+    boundingVolume->callbacks.subscribe([this, type](Entity entity, Entity other, const glm::vec3 &position, const glm::vec3 &normal) {
+        mCollisionResponse.typedStaticCollision(type, entity, other, position, normal);
+    });
+    mEcs.add(entity, boundingVolume);
+    return entity;
+}
+
+Entity PhysicsWorld::createFloor()
+{
+    Entity floor = createBody(glm::vec3(0.f));
+    std::shared_ptr<BoundingVolume> floorHitBox = std::make_shared<BoundingBox>(floor, glm::vec3(50.f, 0.1f, 50.f));
+    mEcs.add(floor, Velocity { glm::vec3(0.f) });
+    mEcs.add(floor, floorHitBox);
+    mEcs.add(floor, Kinematic());
+    return floor;
+}
+
+void PhysicsWorld::createCollisionSystems()
+{
+    mEcs.createSystem<TreeBuilder>(mTree, mHierarchy);
+    mEcs.createSystem<CollisionDetection>(mTree, mHierarchy);
+}
+
+void PhysicsWorld::step()
+{
+    timers::FixedTimeScope fixedTimeScope(mFixedTime);
+    mEcs.fixedUpdate();
+    mEcs.update();
+    ++mTicks;
+}
+
+void PhysicsWorld::applyForce(const uint32_t body, const glm::vec3 &force)
+{
+    if (body >= mBodies.size())
+    {
+        debug::log("Body " + std::to_string(body) + " was not created by this world.", debug::severity::Warning);
+        return;
+    }
+    
+    const auto &[entity, dynamicType] = mBodies[body];
+    
+    // Bodies with a type always have a DynamicObject. Static bodies (e.g., the floor) never do.
+    if (!dynamicType.has_value() && !mEcs.hasComponent<DynamicObject>(entity))
+    {
+        debug::log("Body " + std::to_string(body) + " is static so it cannot be pushed.", debug::severity::Warning);
+        return;
+    }
+    
+    DynamicObject &dynamicObject = dynamicType.has_value()
+        ? mEcs.getComponent<DynamicObject>(entity, dynamicType.value())
+        : mEcs.getComponent<DynamicObject>(entity);
+    dynamicObject.force += force;
+    
+    if (mRecording.has_value())
+        mRecording->inputs.push_back({ mTicks, body, force });
+}
+
+PhysicsSnapshot PhysicsWorld::snapshot()
+{
+    PhysicsSnapshot snapshot;
+    snapshot.capture(mEcs, mBodies, mTicks);
+    return snapshot;
+}
+
+void PhysicsWorld::restore(const PhysicsSnapshot &snapshot)
+{
+    snapshot.restore(mEcs, mBodies, *mHierarchy);
+    mTicks = snapshot.tick();
+}
+
+void PhysicsWorld::startRecording()
+{
+    mRecording = PhysicsRecording { snapshot() };
+}
+
+PhysicsRecording PhysicsWorld::stopRecording()
+{
+    PhysicsRecording recording = std::move(mRecording.value());
+    recording.ticks = mTicks - recording.start.tick();
+    mRecording.reset();
+    return recording;
+}
+
+void PhysicsWorld::replay(const PhysicsRecording &recording)
+{
+    restore(recording.start);
+    
+    // Inputs are recorded in tick order, so they can be walked alongside the ticks.
+    auto input = recording.inputs.begin();
+    for (uint64_t i = 0; i < recording.ticks; ++i)
+    {
+        for (; input != recording.inputs.end() && input->tick == mTicks; ++input)
+            applyForce(input->body, input->force);
+        step();
+    }
+}
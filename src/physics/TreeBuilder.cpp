@@ -7,27 +7,30 @@
 
 #include "TreeBuilder.h"
 #include "PhysicsHelpers.h"
+#include "ConvexHull.h"
 #include "Timers.h"
+#include "ext/matrix_transform.hpp"
 
-TreeBuilder::TreeBuilder(std::shared_ptr<octree::Tree<CollisionEntity>> tree)
-    : mTree(std::move(tree))
+TreeBuilder::TreeBuilder(std::shared_ptr<octree::Tree<CollisionEntity>> tree, std::shared_ptr<TransformHierarchy> hierarchy)
+    : mTree(std::move(tree)), mHierarchy(std::move(hierarchy))
 {
     mEntities.forEach([this](
         std::shared_ptr<BoundingVolume> &boundingVolume,
-        std::shared_ptr<ModelMatrix> &basicUniforms,
+        const TransformNode &node,
         const Velocity &velocity)
     {
-        const glm::vec3 center = basicUniforms->value * glm::vec4(velocity.value * timers::fixedTime<float>(), 1.f);
+        const glm::mat4 &modelMatrix = mHierarchy->world(node);
+        const glm::vec3 center = modelMatrix * glm::vec4(velocity.value * timers::fixedTime<float>(), 1.f);
         if (auto sphere = std::dynamic_pointer_cast<BoundingSphere>(boundingVolume))
         {
             const glm::vec3 axisAlignedHalfSize = glm::vec3(sphere->radius);
         
             octree::AABB bounds { center, axisAlignedHalfSize };
-            mTree->insert({ boundingVolume, basicUniforms, velocity }, bounds);
+            mTree->insert({ boundingVolume, node, velocity }, bounds);
         }
         if (auto box = std::dynamic_pointer_cast<BoundingBox>(boundingVolume))
         {
-            auto points = physics::boxToVertex(basicUniforms->value, box->halfSize);
+            auto points = physics::boxToVertex(modelMatrix, box->halfSize);
             glm::vec3 max = glm::vec3(0.f);
         
             for (auto &point : points)
@@ -36,7 +39,15 @@ TreeBuilder::TreeBuilder(std::shared_ptr<octree::Tree<CollisionEntity>> tree)
             }
             max = (max - glm::abs(center));
             octree::AABB bounds { center, max };
-            mTree->insert({ boundingVolume, basicUniforms, velocity }, bounds);
+            mTree->insert({ boundingVolume, node, velocity }, bounds);
+        }
+        if (auto hull = std::dynamic_pointer_cast<BoundingConvexHull>(boundingVolume))
+        {
+            const glm::mat4 movedMatrix = glm::translate(modelMatrix, velocity.value * timers::fixedTime<float>());
+            const auto [hullCenter, halfSize] = physics::axisAlignedBounds(movedMatrix, hull->hull->centre(), hull->hull->halfSize());
+            
+            octree::AABB bounds { hullCenter, halfSize };
+            mTree->insert({ boundingVolume, node, velocity }, bounds);
         }
     });
     scheduleFor(ecs::PreFixedUpdate);
@@ -0,0 +1,91 @@
+/**
+ * @file WorldBatch.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "WorldBatch.h"
+#include "Components.h"
+#include "Physics.h"
+#include "Timers.h"
+
+#include <fstream>
+
+WorldBatch::WorldBatch(const uint32_t worldCount, const Setup &setup)
+{
+    mWorlds.reserve(worldCount);
+    mBodies.reserve(worldCount);
+    for (uint32_t i = 0; i < worldCount; ++i)
+    {
+        mWorlds.push_back(std::make_unique<PhysicsWorld>());
+        mBodies.push_back(setup(*mWorlds.back(), i));
+    }
+}
+
+void WorldBatch::run(const uint32_t ticks, WorkStealingPool *pool)
+{
+    mResults.ticks = ticks;
+    mResults.tickMilliseconds.assign(static_cast<std::size_t>(ticks) * mWorlds.size(), 0.0);
+    
+    // One world per task, so that worlds that take longer are balanced by stealing.
+    pool->parallelFor(size(), 1, [&](const uint32_t first, const uint32_t last) {
+        for (uint32_t i = first; i < last; ++i)
+        {
+            // Each world only ever writes to its own slice of the timings.
+            double *tickMilliseconds = &mResults.tickMilliseconds[static_cast<std::size_t>(i) * ticks];
+            for (uint32_t tick = 0; tick < ticks; ++tick)
+                tickMilliseconds[tick] = timers::measure([&]() { mWorlds[i]->step(); });
+        }
+    });
+    
+    collect();
+}
+
+void WorldBatch::collect()
+{
+    for (std::vector<float> *column : {
+        &mResults.positionX, &mResults.positionY, &mResults.positionZ,
+        &mResults.velocityX, &mResults.velocityY, &mResults.velocityZ })
+    {
+        column->clear();
+    }
+    mResults.world.clear();
+    mResults.body.clear();
+    
+    for (uint32_t i = 0; i < mWorlds.size(); ++i)
+    {
+        ecs::Core &ecs = mWorlds[i]->ecs();
+        for (uint32_t j = 0; j < mBodies[i].size(); ++j)
+        {
+            const glm::vec3 &position = ecs.getComponent<Position>(mBodies[i][j]).value;
+            const glm::vec3 &velocity = ecs.getComponent<Velocity>(mBodies[i][j]).value;
+            
+            mResults.world.emplace_back(i);
+            mResults.body.emplace_back(j);
+            mResults.positionX.emplace_back(position.x);
+            mResults.positionY.emplace_back(position.y);
+            mResults.positionZ.emplace_back(position.z);
+            mResults.velocityX.emplace_back(velocity.x);
+            mResults.velocityY.emplace_back(velocity.y);
+            mResults.velocityZ.emplace_back(velocity.z);
+        }
+    }
+}
+
+void WorldBatch::writeCsv(const std::string &statePath, const std::string &timingPath) const
+{
+    std::ofstream state(statePath);
+    state << "world,body,x,y,z,vx,vy,vz\n";
+    for (std::size_t i = 0; i < mResults.world.size(); ++i)
+    {
+        state << mResults.world[i] << "," << mResults.body[i] << ","
+              << mResults.positionX[i] << "," << mResults.positionY[i] << "," << mResults.positionZ[i] << ","
+              << mResults.velocityX[i] << "," << mResults.velocityY[i] << "," << mResults.velocityZ[i] << "\n";
+    }
+    
+    std::ofstream timing(timingPath);
+    timing << "world,tick,milliseconds\n";
+    for (std::size_t i = 0; i < mResults.tickMilliseconds.size(); ++i)
+        timing << i / mResults.ticks << "," << i % mResults.ticks << "," << mResults.tickMilliseconds[i] << "\n";
+}
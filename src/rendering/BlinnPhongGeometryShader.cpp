@@ -8,28 +8,18 @@
 #include "BlinnPhongGeometryShader.h"
 
 BlinnPhongGeometryShader::BlinnPhongGeometryShader(
-    std::shared_ptr<MainCamera> camera, std::shared_ptr<FramebufferObject> framebuffer)
+    std::shared_ptr<GeometryBatch> batch, std::shared_ptr<TransformHierarchy> hierarchy)
     :
-    mCamera(std::move(camera)), mFrameBufferObject(std::move(framebuffer))
+    mBatch(std::move(batch)), mHierarchy(std::move(hierarchy))
 {
     mEntities.forEach([this](
         const RenderInformation &renderCoreElements,
-        const std::shared_ptr<ModelMatrix> &uniforms,
+        const TransformNode &node,
         const BlinnPhongMaterial &material)
     {
-        mShader.set("u_mvp", mCamera->getVpMatrix() * uniforms->value);
-        mShader.set("u_model_matrix", uniforms->value);
-        mShader.set("u_colour", material.diffuseColour);
-        mShader.set("u_texture", material.diffuseTextureId, 0);
-    
-        glBindVertexArray(renderCoreElements.vao);
-        glDrawElements(GL_TRIANGLES, renderCoreElements.eboCount, GL_UNSIGNED_INT, 0);
+        mBatch->add(
+            renderCoreElements, { material.diffuseTextureId, 0 }, material.batchId,
+            { mHierarchy->world(node), glm::vec4(material.diffuseColour, 1.f) });
     });
     scheduleFor(ecs::Render);
 }
-
-void BlinnPhongGeometryShader::onUpdate()
-{
-    mShader.bind();
-    mFrameBufferObject->bind();
-}
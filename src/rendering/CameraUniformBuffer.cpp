@@ -0,0 +1,28 @@
+/**
+ * @file CameraUniformBuffer.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "CameraUniformBuffer.h"
+
+CameraUniformBuffer::CameraUniformBuffer()
+{
+    glCreateBuffers(1, &mName);
+    glNamedBufferStorage(mName, sizeof(CameraUniforms), nullptr, GL_DYNAMIC_STORAGE_BIT);
+}
+
+CameraUniformBuffer::~CameraUniformBuffer()
+{
+    glDeleteBuffers(1, &mName);
+}
+
+void CameraUniformBuffer::update(const MainCamera &camera)
+{
+    mUniforms.viewProjection = camera.getVpMatrix();
+    mUniforms.position = camera.getPosition();
+    
+    glNamedBufferSubData(mName, 0, sizeof(CameraUniforms), &mUniforms);
+    glBindBufferBase(GL_UNIFORM_BUFFER, bindingPoint, mName);
+}
@@ -8,31 +8,18 @@
 #include "EmissivePbrGeometryShader.h"
 
 EmissivePbrGeometryShader::EmissivePbrGeometryShader(
-    std::shared_ptr<MainCamera> camera,
-    std::shared_ptr<FramebufferObject> output)
+    std::shared_ptr<GeometryBatch> batch, std::shared_ptr<TransformHierarchy> hierarchy)
     :
-    mCamera(std::move(camera)), mOutput(std::move(output))
+    mBatch(std::move(batch)), mHierarchy(std::move(hierarchy))
 {
     mEntities.forEach([this](
         const RenderInformation &renderCoreElements,
-        const std::shared_ptr<ModelMatrix> &uniforms,
+        const TransformNode &node,
         const EmissivePbrMaterial &material)
     {
-        mShader.set("u_mvp", mCamera->getVpMatrix() * uniforms->value);
-        mShader.set("u_model_matrix", uniforms->value);
-        mShader.set("u_colour", material.diffuseColour);
-    
-        mShader.set("u_diffuse_texture", material.diffuseTextureId, 0);
-        mShader.set("u_emissive_texture", material.emissiveTextureId, 1);
-    
-        glBindVertexArray(renderCoreElements.vao);
-        glDrawElements(GL_TRIANGLES, renderCoreElements.eboCount, GL_UNSIGNED_INT, 0);
+        mBatch->add(
+            renderCoreElements, { material.diffuseTextureId, material.emissiveTextureId }, material.batchId,
+            { mHierarchy->world(node), glm::vec4(material.diffuseColour, 1.f) });
     });
     scheduleFor(ecs::Render);
 }
-
-void EmissivePbrGeometryShader::onUpdate()
-{
-    mShader.bind();
-    mOutput->bind();
-}
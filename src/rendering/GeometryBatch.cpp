@@ -0,0 +1,345 @@
+/**
+ * @file GeometryBatch.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "GeometryBatch.h"
+
+#include <numeric>
+#include <cstring>
+
+namespace
+{
+    // The bits of the distance at the bottom of a sort key. The ids above it are sized in BatchIds.h.
+    constexpr uint32_t distanceBits { 16 };
+    static_assert(distanceBits + batch::meshBits + batch::vaoBits + batch::materialBits == 64);
+    
+    /** Keys that are the same above this shift are the same mesh, which can be drawn as instances of one command. */
+    constexpr uint32_t meshShift    { distanceBits };
+    
+    /** Keys that are the same above this shift share a vao and textures, which can be drawn with one call. */
+    constexpr uint32_t stateShift   { distanceBits + batch::meshBits };
+    
+    /**
+     * @brief Sorts keys from smallest to largest, moving values with them. A least significant digit radix sort of
+     * a byte a pass, which skips any byte that every key shares.
+     */
+    void radixSort(
+        std::vector<uint64_t> &keys, std::vector<uint32_t> &values,
+        std::vector<uint64_t> &keysScratch, std::vector<uint32_t> &valuesScratch)
+    {
+        keysScratch.resize(keys.size());
+        valuesScratch.resize(values.size());
+        
+        for (uint32_t shift = 0; shift < 64; shift += 8)
+        {
+            std::array<uint32_t, 256> offsets {};
+            for (const uint64_t key : keys)
+                ++offsets[(key >> shift) & 0xFF];
+            
+            if (offsets[(keys[0] >> shift) & 0xFF] == keys.size())
+                continue;
+            
+            uint32_t total = 0;
+            for (uint32_t &offset : offsets)
+            {
+                const uint32_t count = offset;
+                offset = total;
+                total += count;
+            }
+            
+            for (std::size_t i = 0; i < keys.size(); ++i)
+            {
+                const uint32_t to = offsets[(keys[i] >> shift) & 0xFF]++;
+                keysScratch[to] = keys[i];
+                valuesScratch[to] = values[i];
+            }
+            
+            keys.swap(keysScratch);
+            values.swap(valuesScratch);
+        }
+    }
+}
+
+GeometryBatch::StorageBuffer::StorageBuffer()
+{
+    glCreateBuffers(1, &name);
+}
+
+GeometryBatch::StorageBuffer::~StorageBuffer()
+{
+    glDeleteBuffers(1, &name);
+}
+
+void GeometryBatch::StorageBuffer::reserve(const std::size_t bytes)
+{
+    if (bytes <= capacity)
+        return;
+    
+    capacity = std::max(bytes, capacity * 2);
+    glNamedBufferData(name, static_cast<GLsizeiptr>(capacity), nullptr, GL_DYNAMIC_DRAW);
+}
+
+void GeometryBatch::StorageBuffer::upload(const void *data, const std::size_t bytes)
+{
+    reserve(bytes);
+    glNamedBufferSubData(name, 0, static_cast<GLsizeiptr>(bytes), data);
+}
+
+GeometryBatch::GeometryBatch(
+    const std::filesystem::path &vertexPath, const std::filesystem::path &fragmentPath,
+    std::vector<std::string> samplerNames)
+    : mShader(vertexPath, fragmentPath)
+{
+    for (const std::string &samplerName : samplerNames)
+        mSamplers.emplace_back(mShader.uniform<TextureUnit>(samplerName));
+    
+    mCounterBuffer.reserve(sizeof(CullingCounters));
+}
+
+void GeometryBatch::add(
+    const RenderInformation &renderInformation, const Textures &textures, const uint32_t materialId,
+    const GeometryInstance &instance)
+{
+    mKeys.push_back({
+        renderInformation.vao, textures, renderInformation.firstIndex, renderInformation.baseVertex,
+        renderInformation.eboCount, materialId, renderInformation.vaoId, renderInformation.meshId });
+    mBounds.emplace_back(renderInformation.bounds);
+    mInstances.emplace_back(instance);
+}
+
+void GeometryBatch::draw(const glm::vec3 &cameraPosition, const HierarchicalDepth *depth)
+{
+    // The counters of the last pass are read here, which leaves the gpu a whole frame to have finished them.
+    if (mHasCounters)
+    {
+        glGetNamedBufferSubData(mCounterBuffer.name, 0, sizeof(CullingCounters), &mCullingCounters);
+        mHasCounters = false;
+    }
+    
+    mInstanceCount = static_cast<uint32_t>(mInstances.size());
+    mCommandCount = 0;
+    mDrawCount = 0;
+    mBindCounters = BindCounters();
+    if (mInstances.empty())
+        return;
+    
+    // The order they were added in is the order they would have been drawn in without sorting.
+    mOrder.resize(mKeys.size());
+    std::iota(mOrder.begin(), mOrder.end(), 0);
+    mBindCounters.unsorted = countBinds(mOrder);
+    
+    // Sorting an index keeps the instances themselves from being moved more than once.
+    mSortKeys.resize(mKeys.size());
+    for (std::size_t i = 0; i < mKeys.size(); ++i)
+        mSortKeys[i] = sortKey(mKeys[i], glm::distance(cameraPosition, glm::vec3(mInstances[i].modelMatrix[3])));
+    
+    radixSort(mSortKeys, mOrder, mSortKeysScratch, mOrderScratch);
+    
+    mSortedInstances.resize(mInstances.size());
+    for (std::size_t i = 0; i < mOrder.size(); ++i)
+        mSortedInstances[i] = mInstances[mOrder[i]];
+    
+    // Each command starts at its first instance, which the shader reads back through gl_BaseInstance.
+    mCommands.clear();
+    mCommandBounds.clear();
+    mInstanceCommands.resize(mOrder.size());
+    for (uint32_t first = 0; first < mOrder.size();)
+    {
+        const Key &key = mKeys[mOrder[first]];
+        uint32_t last = first + 1;
+        while (last < mOrder.size() && (mSortKeys[last] >> meshShift) == (mSortKeys[first] >> meshShift))
+            ++last;
+        
+        // The culling pass counts the instances of each command itself.
+        const uint32_t instances = mIsCulling ? 0 : last - first;
+        const auto command = static_cast<uint32_t>(mCommands.size());
+        std::fill(mInstanceCommands.begin() + first, mInstanceCommands.begin() + last, command);
+        mCommands.push_back({ static_cast<uint32_t>(key.eboCount), instances, key.firstIndex, key.baseVertex, first });
+        mCommandBounds.emplace_back(mBounds[mOrder[first]]);
+        first = last;
+    }
+    
+    mInstanceBuffer.upload(mSortedInstances.data(), mSortedInstances.size() * sizeof(GeometryInstance));
+    mCommandBuffer.upload(mCommands.data(), mCommands.size() * sizeof(DrawElementsIndirectCommand));
+    
+    if (mIsCulling)
+        cull(depth);
+    else
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, mInstanceBuffer.name);
+    
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, mCommandBuffer.name);
+    
+    mShader.bind();
+    
+    // Commands are in key order, so every command that can be drawn together is next to each other. Only the state
+    // that differs from the last call is bound.
+    unsigned int boundVao = 0;
+    Textures boundTextures { 0, 0 };
+    uint32_t firstCommand = 0;
+    for (uint32_t i = 1; i <= mCommands.size(); ++i)
+    {
+        const uint64_t state = mSortKeys[mCommands[firstCommand].baseInstance] >> stateShift;
+        if (i < mCommands.size() && mSortKeys[mCommands[i].baseInstance] >> stateShift == state)
+            continue;
+        
+        const Key &key = mKeys[mOrder[mCommands[firstCommand].baseInstance]];
+        for (std::size_t j = 0; j < mSamplers.size(); ++j)
+        {
+            if (firstCommand > 0 && boundTextures[j] == key.textures[j])
+                continue;
+            
+            mSamplers[j].set({ key.textures[j], static_cast<int>(j) });
+            boundTextures[j] = key.textures[j];
+            ++mBindCounters.sorted;
+        }
+        
+        if (firstCommand == 0 || boundVao != key.vao)
+        {
+            glBindVertexArray(key.vao);
+            boundVao = key.vao;
+            ++mBindCounters.sorted;
+        }
+        
+        const auto offset = static_cast<std::uintptr_t>(firstCommand) * sizeof(DrawElementsIndirectCommand);
+        glMultiDrawElementsIndirect(
+            GL_TRIANGLES, GL_UNSIGNED_INT, reinterpret_cast<const void *>(offset),
+            static_cast<GLsizei>(i - firstCommand), 0);
+        
+        ++mDrawCount;
+        firstCommand = i;
+    }
+    
+    mCommandCount = static_cast<uint32_t>(mCommands.size());
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    
+    mKeys.clear();
+    mBounds.clear();
+    mInstances.clear();
+}
+
+void GeometryBatch::cull(const HierarchicalDepth *depth)
+{
+    constexpr uint32_t groupSize { 64 };  // Must match local_size_x in Cull.comp.
+    
+    const CullingCounters zero;
+    mCounterBuffer.upload(&zero, sizeof(CullingCounters));
+    mInstanceCommandBuffer.upload(mInstanceCommands.data(), mInstanceCommands.size() * sizeof(uint32_t));
+    mBoundsBuffer.upload(mCommandBounds.data(), mCommandBounds.size() * sizeof(glm::vec4));
+    mVisibleBuffer.reserve(mSortedInstances.size() * sizeof(GeometryInstance));
+    
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, mVisibleBuffer.name);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, mInstanceBuffer.name);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, mInstanceCommandBuffer.name);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, mCommandBuffer.name);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, mBoundsBuffer.name);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 5, mCounterBuffer.name);
+    
+    const bool hasDepth = depth != nullptr && depth->isValid();
+    mCull.bind();
+    mCullInstanceCount.set(static_cast<int>(mSortedInstances.size()));
+    mCullUseDepth.set(hasDepth ? 1 : 0);
+    if (hasDepth)
+    {
+        mCullDepth.set({ depth->getName(), 0 });
+        mCullDepthLevels.set(depth->getLevels());
+    }
+    
+    glDispatchCompute((static_cast<uint32_t>(mSortedInstances.size()) + groupSize - 1) / groupSize, 1, 1);
+    
+    // The draw reads the instance counts as commands and the packed instances from the vertex shader.
+    glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+    mHasCounters = true;
+}
+
+uint64_t GeometryBatch::sortKey(const Key &key, const float distance)
+{
+    // The bits of a positive float sort in the same order as it does, and the top of them keep about two
+    // significant figures, which is plenty to draw near instances first.
+    uint32_t distanceBitPattern { 0 };
+    std::memcpy(&distanceBitPattern, &distance, sizeof(float));
+    
+    // The ids are checked when they are given out. Masking them as well means that one can never spill into another.
+    constexpr auto mask = [](const uint32_t id, const uint32_t bits) { return id & ((1ull << bits) - 1); };
+    
+    return mask(key.materialId, batch::materialBits) << (distanceBits + batch::meshBits + batch::vaoBits)
+        | mask(key.vaoId, batch::vaoBits) << (distanceBits + batch::meshBits)
+        | mask(key.meshId, batch::meshBits) << distanceBits
+        | distanceBitPattern >> (32 - distanceBits);
+}
+
+uint32_t GeometryBatch::countBinds(const std::vector<uint32_t> &order) const
+{
+    uint32_t binds = 0;
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+        const Key &key = mKeys[order[i]];
+        const Key *last = i > 0 ? &mKeys[order[i - 1]] : nullptr;
+        
+        if (last == nullptr || last->vao != key.vao)
+            ++binds;
+        
+        for (std::size_t j = 0; j < mSamplers.size(); ++j)
+        {
+            if (last == nullptr || last->textures[j] != key.textures[j])
+                ++binds;
+        }
+    }
+    
+    return binds;
+}
+
+void GeometryBatch::setCulling(const bool isCulling)
+{
+    mIsCulling = isCulling;
+}
+
+bool GeometryBatch::isCulling() const
+{
+    return mIsCulling;
+}
+
+uint32_t GeometryBatch::drawCount() const
+{
+    return mDrawCount;
+}
+
+uint32_t GeometryBatch::commandCount() const
+{
+    return mCommandCount;
+}
+
+uint32_t GeometryBatch::instanceCount() const
+{
+    return mInstanceCount;
+}
+
+const BindCounters &GeometryBatch::bindCounters() const
+{
+    return mBindCounters;
+}
+
+const CullingCounters &GeometryBatch::cullingCounters() const
+{
+    return mCullingCounters;
+}
+
+GeometryBatchRenderer::GeometryBatchRenderer(
+    std::shared_ptr<GeometryBatch> batch, std::shared_ptr<MainCamera> camera,
+    std::shared_ptr<FramebufferObject> framebuffer, std::shared_ptr<HierarchicalDepth> depth)
+    :
+    mBatch(std::move(batch)), mCamera(std::move(camera)), mFrameBufferObject(std::move(framebuffer)),
+    mDepth(std::move(depth))
+{
+    // All the work is done in onUpdate().
+    mEntities.forEach([](const RenderInformation &, const TransformNode &) {});
+    scheduleFor(ecs::Render);
+}
+
+void GeometryBatchRenderer::onUpdate()
+{
+    mFrameBufferObject->bind();
+    mBatch->draw(mCamera->getPosition(), mDepth.get());
+}
@@ -0,0 +1,65 @@
+/**
+ * @file GpuTimer.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "GpuTimer.h"
+
+GpuTimer::GpuTimer()
+{
+    glCreateQueries(GL_TIME_ELAPSED, static_cast<int>(queryCount), mQueries.data());
+}
+
+GpuTimer::~GpuTimer()
+{
+    glDeleteQueries(static_cast<int>(queryCount), mQueries.data());
+}
+
+void GpuTimer::begin()
+{
+    poll();
+    if (mIsPending[mNext])
+        return;
+    
+    glBeginQuery(GL_TIME_ELAPSED, mQueries[mNext]);
+    mIsTiming = true;
+}
+
+void GpuTimer::end()
+{
+    if (!mIsTiming)
+        return;
+    
+    glEndQuery(GL_TIME_ELAPSED);
+    mIsPending[mNext] = true;
+    mNext = (mNext + 1) % queryCount;
+    mIsTiming = false;
+}
+
+double GpuTimer::milliseconds() const
+{
+    return mMilliseconds;
+}
+
+void GpuTimer::poll()
+{
+    // Queries finish in the order they were made, so the oldest is always checked first.
+    for (std::size_t i = 0; i < queryCount; ++i)
+    {
+        const std::size_t query = (mNext + i) % queryCount;
+        if (!mIsPending[query])
+            continue;
+        
+        int isAvailable { 0 };
+        glGetQueryObjectiv(mQueries[query], GL_QUERY_RESULT_AVAILABLE, &isAvailable);
+        if (!isAvailable)
+            return;
+        
+        GLuint64 nanoseconds { 0 };
+        glGetQueryObjectui64v(mQueries[query], GL_QUERY_RESULT, &nanoseconds);
+        mMilliseconds = static_cast<double>(nanoseconds) / 1000000.0;
+        mIsPending[query] = false;
+    }
+}
@@ -0,0 +1,92 @@
+/**
+ * @file HierarchicalDepth.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "HierarchicalDepth.h"
+
+namespace
+{
+    /** Must match local_size_x and local_size_y in HierarchicalDepth.comp. */
+    constexpr int groupSize { 8 };
+}
+
+HierarchicalDepth::HierarchicalDepth(const glm::ivec2 &size)
+    : mSize(size)
+{
+    mLevels = 1 + static_cast<int>(std::floor(std::log2(static_cast<float>(glm::max(size.x, size.y)))));
+    mPyramid = std::make_unique<MipmapTexture>(mSize, GL_R32F, mLevels, "Hierarchical Depth");
+    
+    glCreateTextures(GL_TEXTURE_2D, 1, &mDepthTexture);
+    glTextureParameteri(mDepthTexture, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTextureParameteri(mDepthTexture, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTextureStorage2D(mDepthTexture, 1, GL_DEPTH24_STENCIL8, mSize.x, mSize.y);
+    
+    glCreateFramebuffers(1, &mDepthFbo);
+    glNamedFramebufferTexture(mDepthFbo, GL_DEPTH_STENCIL_ATTACHMENT, mDepthTexture, 0);
+}
+
+HierarchicalDepth::~HierarchicalDepth()
+{
+    glDeleteFramebuffers(1, &mDepthFbo);
+    glDeleteTextures(1, &mDepthTexture);
+}
+
+void HierarchicalDepth::build(const FramebufferObject &source)
+{
+    glBlitNamedFramebuffer(
+        source.getFboName(), mDepthFbo, 0, 0, mSize.x, mSize.y, 0, 0, mSize.x, mSize.y,
+        GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+    
+    mReduce.bind();
+    reduce(mDepthTexture, 0, mSize, 0, mSize);
+    
+    glm::ivec2 inputSize = mSize;
+    for (int level = 1; level < mLevels; ++level)
+    {
+        const glm::ivec2 outputSize = glm::max(inputSize / 2, glm::ivec2(1));
+        reduce(mPyramid->getName(), level - 1, inputSize, level, outputSize);
+        inputSize = outputSize;
+    }
+    
+    glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+    mIsValid = true;
+}
+
+void HierarchicalDepth::reduce(
+    const unsigned int input, const int inputLevel, const glm::ivec2 &inputSize,
+    const int outputLevel, const glm::ivec2 &outputSize)
+{
+    mInput.set({ input, 0 });
+    mInputLevel.set(inputLevel);
+    mInputSize.set(glm::vec2(inputSize));
+    mOutputSize.set(glm::vec2(outputSize));
+    glBindImageTexture(0, mPyramid->getName(), outputLevel, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+    
+    glDispatchCompute((outputSize.x + groupSize - 1) / groupSize, (outputSize.y + groupSize - 1) / groupSize, 1);
+    
+    // The next level reads this one.
+    glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+}
+
+bool HierarchicalDepth::isValid() const
+{
+    return mIsValid;
+}
+
+unsigned int HierarchicalDepth::getName() const
+{
+    return mPyramid->getName();
+}
+
+int HierarchicalDepth::getLevels() const
+{
+    return mLevels;
+}
+
+const glm::ivec2 &HierarchicalDepth::getSize() const
+{
+    return mSize;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file ClusteredLighting.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "ClusteredLighting.h"
+#include "ModelDestroyer.h"
+
+namespace
+{
+    constexpr int clusterCount { ClusteredLighting::gridX * ClusteredLighting::gridY * ClusteredLighting::gridZ };
+}
+
+ClusteredLighting::ClusteredLighting(
+    std::shared_ptr<MainCamera> camera,
+    std::shared_ptr<FramebufferObject> lightAccumulationBuffer,
+    std::shared_ptr<TextureBufferObject> positions,
+    std::shared_ptr<TextureBufferObject> normals,
+    std::shared_ptr<TextureBufferObject> albedo)
+    :
+    mCamera(std::move(camera)),
+    mLightAccumulationBuffer(std::move(lightAccumulationBuffer)),
+    mPositions(std::move(positions)),
+    mNormals(std::move(normals)),
+    mAlbedo(std::move(albedo))
+{
+    glCreateBuffers(1, &mLightBuffer);
+    glCreateBuffers(1, &mCountBuffer);
+    glCreateBuffers(1, &mIndexBuffer);
+    glCreateBuffers(1, &mOverflowBuffer);
+    
+    // Only ever written by the gpu.
+    glNamedBufferStorage(mCountBuffer, clusterCount * sizeof(uint32_t), nullptr, 0);
+    glNamedBufferStorage(mIndexBuffer, clusterCount * maxLightsPerCluster * sizeof(uint32_t), nullptr, 0);
+    glNamedBufferStorage(mOverflowBuffer, sizeof(Overflow), &mOverflow, 0);
+}
+
+ClusteredLighting::~ClusteredLighting()
+{
+    glDeleteBuffers(1, &mLightBuffer);
+    glDeleteBuffers(1, &mCountBuffer);
+    glDeleteBuffers(1, &mIndexBuffer);
+    glDeleteBuffers(1, &mOverflowBuffer);
+    destroy::mesh(mQuad);
+}
+
+void ClusteredLighting::setEnabled(const bool isEnabled)
+{
+    mIsEnabled = isEnabled;
+}
+
+bool ClusteredLighting::isEnabled() const
+{
+    return mIsEnabled;
+}
+
+void ClusteredLighting::add(const glm::vec3 &position, const light::PointLight &pointLight)
+{
+    const glm::vec3 viewPosition = mCamera->getViewMatrix() * glm::vec4(position, 1.f);
+    mLights.push_back({ position, pointLight.distance, pointLight.intensity, pointLight.power, viewPosition });
+}
+
+void ClusteredLighting::render()
+{
+    cluster();
+    if (mLightCount == 0)
+        return;
+    
+    mShader.bind();
+    mLightAccumulationBuffer->bind();
+    
+    mPositionsUnit.set({ mPositions->getName(), 0 });
+    mNormalsUnit.set({ mNormals->getName(), 1 });
+    mAlbedoUnit.set({ mAlbedo->getName(), 2 });
+    
+    mMvpMatrix.set(glm::mat4(1.f));
+    mView.set(mCamera->getViewMatrix());
+    mNear.set(nearSlice);
+    mFar.set(mCamera->getFarClip());
+    
+    glBindVertexArray(mQuad.renderInformation.vao);
+    drawElements(mQuad.renderInformation);
+}
+
+void ClusteredLighting::cluster()
+{
+    // Lights are only ever added while this is enabled.
+    mLightCount = static_cast<uint32_t>(mLights.size());
+    if (mLights.empty())
+    {
+        mOverflow = Overflow();
+        return;
+    }
+    
+    // The last frame's dispatch has finished by now, so this does not wait for the one below.
+    glGetNamedBufferSubData(mOverflowBuffer, 0, sizeof(Overflow), &mOverflow);
+    glClearNamedBufferData(mOverflowBuffer, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+    
+    glNamedBufferData(
+        mLightBuffer, static_cast<GLsizeiptr>(mLights.size() * sizeof(ClusterLight)), mLights.data(),
+        GL_STREAM_DRAW);
+    
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, mLightBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, mCountBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, mIndexBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, mOverflowBuffer);
+    
+    mCluster.bind();
+    mInverseProjection.set(glm::inverse(mCamera->getProjectionMatrix()));
+    mClusterLightCount.set(static_cast<int>(mLights.size()));
+    mClusterNear.set(nearSlice);
+    mClusterFar.set(mCamera->getFarClip());
+    glDispatchCompute(gridX, gridY, gridZ);
+    
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+    mLights.clear();
+}
+
+uint32_t ClusteredLighting::lightCount() const
+{
+    return mLightCount;
+}
+
+uint32_t ClusteredLighting::droppedLights() const
+{
+    return mOverflow.droppedLights;
+}
+
+uint32_t ClusteredLighting::fullClusters() const
+{
+    return mOverflow.fullClusters;
+}
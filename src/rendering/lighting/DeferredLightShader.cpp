@@ -8,6 +8,7 @@
 #include "DeferredLightShader.h"
 #include "Vertices.h"
 #include "Primitives.h"
+#include "ModelDestroyer.h"
 #include "FramebufferObject.h"
 
 DeferredLightShader::DeferredLightShader(
@@ -21,11 +22,11 @@ DeferredLightShader::DeferredLightShader(
     mSpecular(std::move(specular)), mAlbedo(std::move(albedo)),
     mEmissive(std::move(emissive))
 {
-    const auto mesh = primitives::plane<UvVertex>()[0];
-    mVao      = mesh.renderInformation.vao;
-    mEboCount = mesh.renderInformation.eboCount;
-    mEbo      = mesh.ebo;
-    mVbo      = mesh.vbo;
+}
+
+DeferredLightShader::~DeferredLightShader()
+{
+    destroy::mesh(mQuad);
 }
 
 void DeferredLightShader::render()
@@ -33,13 +34,13 @@ void DeferredLightShader::render()
     mShader.bind();
     mOutput->bind();
     
-    mShader.set("u_diffuse",  mDiffuse->getName(),  0);
-    mShader.set("u_specular", mSpecular->getName(), 1);
-    mShader.set("u_albedo",   mAlbedo->getName(),   2);
-    mShader.set("u_emissive", mEmissive->getName(), 3);
+    mDiffuseUnit.set({ mDiffuse->getName(), 0 });
+    mSpecularUnit.set({ mSpecular->getName(), 1 });
+    mAlbedoUnit.set({ mAlbedo->getName(), 2 });
+    mEmissiveUnit.set({ mEmissive->getName(), 3 });
     
-    mShader.set("u_mvp_matrix", glm::mat4(1.f));
+    mMvpMatrix.set(glm::mat4(1.f));
     
-    glBindVertexArray(mVao);
-    glDrawElements(GL_TRIANGLES, mEboCount, GL_UNSIGNED_INT, 0);
+    glBindVertexArray(mQuad.renderInformation.vao);
+    drawElements(mQuad.renderInformation);
 }
@@ -0,0 +1,58 @@
+/**
+ * @file DirectionalLighting.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "DirectionalLighting.h"
+#include "ModelDestroyer.h"
+
+DirectionalLighting::DirectionalLighting(
+    std::shared_ptr<FramebufferObject> lightAccumulationBuffer,
+    std::shared_ptr<TextureBufferObject> positions,
+    std::shared_ptr<TextureBufferObject> normals,
+    std::shared_ptr<TextureBufferObject> albedo)
+    :
+    mLightAccumulationBuffer(std::move(lightAccumulationBuffer)),
+    mPositions(std::move(positions)),
+    mNormals(std::move(normals)),
+    mAlbedo(std::move(albedo))
+{
+}
+
+DirectionalLighting::~DirectionalLighting()
+{
+    destroy::mesh(mQuad);
+}
+
+void DirectionalLighting::add(const light::DirectionalLight &directionalLight)
+{
+    mLights.push_back(directionalLight);
+}
+
+void DirectionalLighting::render()
+{
+    if (!mLights.empty())
+    {
+        mShader.bind();
+        mLightAccumulationBuffer->bind();
+        
+        mPositionsUnit.set({ mPositions->getName(), 0 });
+        mNormalsUnit.set({ mNormals->getName(), 1 });
+        mAlbedoUnit.set({ mAlbedo->getName(), 2 });
+        
+        mMvpMatrix.set(glm::mat4(1.f));
+        
+        glBindVertexArray(mQuad.renderInformation.vao);
+        for (const light::DirectionalLight &directionalLight : mLights)
+        {
+            mLightDirection.set(directionalLight.direction);
+            mLightIntensity.set(directionalLight.intensity);
+            
+            drawElements(mQuad.renderInformation);
+        }
+    }
+    
+    mLights.clear();
+}
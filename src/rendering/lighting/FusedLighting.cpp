@@ -0,0 +1,105 @@
+/**
+ * @file FusedLighting.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "FusedLighting.h"
+
+namespace
+{
+    /** Must match local_size_x and local_size_y in FusedLighting.comp. */
+    constexpr int groupSize { 8 };
+    
+    /** The size of an RGB16F or RGB16_SNORM texel, which every buffer that this skips is made of. */
+    constexpr uint64_t texelSize { 6 };
+}
+
+FusedLighting::FusedLighting(
+    std::shared_ptr<MainCamera> camera,
+    std::shared_ptr<ClusteredLighting> clusteredLighting,
+    std::shared_ptr<TextureBufferObject> lightTarget,
+    std::shared_ptr<TextureBufferObject> positions,
+    std::shared_ptr<TextureBufferObject> normals,
+    std::shared_ptr<TextureBufferObject> albedo,
+    std::shared_ptr<TextureBufferObject> emissive)
+    :
+    mCamera(std::move(camera)),
+    mClusteredLighting(std::move(clusteredLighting)),
+    mLightTarget(std::move(lightTarget)),
+    mPositions(std::move(positions)),
+    mNormals(std::move(normals)),
+    mAlbedo(std::move(albedo)),
+    mEmissive(std::move(emissive))
+{
+    glCreateBuffers(1, &mDirectionalLightBuffer);
+}
+
+FusedLighting::~FusedLighting()
+{
+    glDeleteBuffers(1, &mDirectionalLightBuffer);
+}
+
+void FusedLighting::setEnabled(const bool isEnabled)
+{
+    mIsEnabled = isEnabled;
+}
+
+bool FusedLighting::isEnabled() const
+{
+    return mIsEnabled;
+}
+
+void FusedLighting::add(const light::DirectionalLight &directionalLight)
+{
+    mDirectionalLights.push_back({ directionalLight.direction, 0.f, directionalLight.intensity });
+}
+
+void FusedLighting::render()
+{
+    mClusteredLighting->cluster();
+    
+    const uint32_t pointLightCount = mClusteredLighting->lightCount();
+    const auto directionalLightCount = static_cast<uint32_t>(mDirectionalLights.size());
+    mPassesReplaced = directionalLightCount + (pointLightCount > 0 ? 1 : 0);
+    
+    // An empty buffer cannot be bound, so there is always at least one light in it, even if it is never read.
+    mDirectionalLights.resize(std::max(directionalLightCount, 1u));
+    glNamedBufferData(
+        mDirectionalLightBuffer, static_cast<GLsizeiptr>(mDirectionalLights.size() * sizeof(FusedDirectionalLight)),
+        mDirectionalLights.data(), GL_STREAM_DRAW);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, mDirectionalLightBuffer);
+    
+    mShader.bind();
+    mPositionsUnit.set({ mPositions->getName(), 0 });
+    mNormalsUnit.set({ mNormals->getName(), 1 });
+    mAlbedoUnit.set({ mAlbedo->getName(), 2 });
+    mEmissiveUnit.set({ mEmissive->getName(), 3 });
+    
+    mView.set(mCamera->getViewMatrix());
+    mNear.set(ClusteredLighting::nearSlice);
+    mFar.set(mCamera->getFarClip());
+    mPointLightCount.set(static_cast<int>(pointLightCount));
+    mDirectionalLightCount.set(static_cast<int>(directionalLightCount));
+    
+    glBindImageTexture(0, mLightTarget->getName(), 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA16F);
+    
+    const glm::ivec2 &size = mLightTarget->getSize();
+    glDispatchCompute((size.x + groupSize - 1) / groupSize, (size.y + groupSize - 1) / groupSize, 1);
+    
+    // Bloom samples the light target next.
+    glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_FRAMEBUFFER_BARRIER_BIT);
+    mDirectionalLights.clear();
+}
+
+uint64_t FusedLighting::savedBytes() const
+{
+    // Per pixel: clearing diffuse and specular, each pass reading position, normal and albedo then blending into
+    // diffuse and specular, and the composite reading diffuse and specular.
+    const uint64_t perPass = 3 * texelSize + 4 * texelSize;
+    const uint64_t perPixel = 2 * texelSize + mPassesReplaced * perPass + 2 * texelSize;
+    
+    const glm::ivec2 &size = mLightTarget->getSize();
+    return perPixel * static_cast<uint64_t>(size.x) * static_cast<uint64_t>(size.y);
+}
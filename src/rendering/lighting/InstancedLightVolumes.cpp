@@ -0,0 +1,95 @@
+/**
+ * @file InstancedLightVolumes.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "InstancedLightVolumes.h"
+#include "ModelDestroyer.h"
+
+InstancedLightVolumes::InstancedLightVolumes(
+    std::shared_ptr<FramebufferObject> lightAccumulationBuffer,
+    std::shared_ptr<FramebufferObject> geometryBuffer,
+    std::shared_ptr<TextureBufferObject> positions,
+    std::shared_ptr<TextureBufferObject> normals,
+    std::shared_ptr<TextureBufferObject> albedo)
+    :
+    mLightAccumulationBuffer(std::move(lightAccumulationBuffer)),
+    mGeometryBuffer(std::move(geometryBuffer)),
+    mPositions(std::move(positions)),
+    mNormals(std::move(normals)),
+    mAlbedo(std::move(albedo))
+{
+    glCreateBuffers(1, &mLightBuffer);
+}
+
+InstancedLightVolumes::~InstancedLightVolumes()
+{
+    glDeleteBuffers(1, &mLightBuffer);
+    destroy::mesh(mVolume);
+}
+
+void InstancedLightVolumes::setEnabled(const bool isEnabled)
+{
+    mIsEnabled = isEnabled;
+}
+
+bool InstancedLightVolumes::isEnabled() const
+{
+    return mIsEnabled;
+}
+
+void InstancedLightVolumes::add(const glm::vec3 &position, const light::PointLight &pointLight)
+{
+    mLights.push_back({ position, pointLight.distance, pointLight.intensity, pointLight.power });
+}
+
+void InstancedLightVolumes::render()
+{
+    mLightCount = static_cast<uint32_t>(mLights.size());
+    if (mIsEnabled && !mLights.empty())
+    {
+        glNamedBufferData(
+            mLightBuffer, static_cast<GLsizeiptr>(mLights.size() * sizeof(VolumeLight)), mLights.data(),
+            GL_STREAM_DRAW);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, mLightBuffer);
+        
+        // The depth of the scene lets the depth test reject pixels that no volume reaches.
+        const glm::ivec2 &size = mGeometryBuffer->getSize();
+        glBlitNamedFramebuffer(
+            mGeometryBuffer->getFboName(), mLightAccumulationBuffer->getFboName(), 0, 0, size.x, size.y,
+            0, 0, size.x, size.y, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+        
+        mShader.bind();
+        mLightAccumulationBuffer->bind();
+        
+        mPositionsUnit.set({ mPositions->getName(), 0 });
+        mNormalsUnit.set({ mNormals->getName(), 1 });
+        mAlbedoUnit.set({ mAlbedo->getName(), 2 });
+        
+        // The volume model has inverted faces, so only its far side is drawn. It passes where it is behind the
+        // scene, which is every pixel whose surface could be inside it. Depth clamping keeps the far side of
+        // volumes that cross the far plane.
+        glDepthFunc(GL_GEQUAL);
+        glDepthMask(GL_FALSE);
+        glEnable(GL_DEPTH_CLAMP);
+        
+        const RenderInformation &volume = mVolume.renderInformation;
+        const auto firstIndex = static_cast<std::uintptr_t>(volume.firstIndex) * sizeof(uint32_t);
+        glBindVertexArray(volume.vao);
+        glDrawElementsInstancedBaseVertex(
+            GL_TRIANGLES, volume.eboCount, GL_UNSIGNED_INT, reinterpret_cast<const void *>(firstIndex),
+            static_cast<int>(mLights.size()), volume.baseVertex);
+        
+        glDisable(GL_DEPTH_CLAMP);
+        glDepthMask(GL_TRUE);
+    }
+    
+    mLights.clear();
+}
+
+uint32_t InstancedLightVolumes::lightCount() const
+{
+    return mLightCount;
+}
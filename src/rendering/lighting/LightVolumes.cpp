@@ -0,0 +1,67 @@
+/**
+ * @file LightVolumes.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "LightVolumes.h"
+#include "ModelDestroyer.h"
+
+LightVolumes::LightVolumes(
+    std::shared_ptr<MainCamera> camera,
+    std::shared_ptr<FramebufferObject> lightAccumulationBuffer,
+    std::shared_ptr<TextureBufferObject> positions,
+    std::shared_ptr<TextureBufferObject> normals,
+    std::shared_ptr<TextureBufferObject> albedo)
+    :
+    mCamera(std::move(camera)),
+    mLightAccumulationBuffer(std::move(lightAccumulationBuffer)),
+    mPositions(std::move(positions)),
+    mNormals(std::move(normals)),
+    mAlbedo(std::move(albedo))
+{
+}
+
+LightVolumes::~LightVolumes()
+{
+    destroy::mesh(mVolume);
+}
+
+void LightVolumes::add(const glm::vec3 &position, const light::PointLight &pointLight)
+{
+    mLights.push_back({ position, pointLight });
+}
+
+void LightVolumes::render()
+{
+    if (!mLights.empty())
+    {
+        mShader.bind();
+        mLightAccumulationBuffer->bind();
+        
+        mPositionsUnit.set({ mPositions->getName(), 0 });
+        mNormalsUnit.set({ mNormals->getName(), 1 });
+        mAlbedoUnit.set({ mAlbedo->getName(), 2 });
+        
+        glBindVertexArray(mVolume.renderInformation.vao);
+        for (const auto &[position, pointLight] : mLights)
+        {
+            const glm::mat4 positionMatrix = glm::translate(glm::mat4(1.f), position);
+            const glm::mat4 scaleMatrix = glm::scale(glm::mat4(1.f), glm::vec3(pointLight.distance));
+            const glm::mat4 mvp = mCamera->getVpMatrix() * positionMatrix * scaleMatrix;
+            
+            mMvpMatrix.set(mvp);
+            mLightPosition.set(position);
+            mLightIntensity.set(pointLight.intensity);
+            mLightDistance.set(pointLight.distance);
+            mLightPower.set(pointLight.power);
+            
+            // The model has inverted faces!
+            // Point lights are always rendered backwards (so you can go inside the mesh).
+            drawElements(mVolume.renderInformation);
+        }
+    }
+    
+    mLights.clear();
+}
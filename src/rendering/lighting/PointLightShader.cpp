@@ -6,66 +6,23 @@
 
 
 #include "PointLightShader.h"
-#include "Primitives.h"
 
 PointLightShader::PointLightShader(
-    std::shared_ptr<MainCamera> camera,
-    std::shared_ptr<FramebufferObject> lightAccumulationBuffer,
-    std::shared_ptr<TextureBufferObject> positions,
-    std::shared_ptr<TextureBufferObject> normals,
-    std::shared_ptr<TextureBufferObject> albedo)
+    std::shared_ptr<LightVolumes> lightVolumes,
+    std::shared_ptr<ClusteredLighting> clusteredLighting,
+    std::shared_ptr<InstancedLightVolumes> instancedLightVolumes)
     :
-    mCamera(std::move(camera)),
-    mLightAccumulationBuffer(std::move(lightAccumulationBuffer)),
-    mPositions(std::move(positions)),
-    mNormals(std::move(normals)),
-    mAlbedo(std::move(albedo))
+    mLightVolumes(std::move(lightVolumes)),
+    mClusteredLighting(std::move(clusteredLighting)),
+    mInstancedLightVolumes(std::move(instancedLightVolumes))
 {
-    const auto mesh = load::model<UvVertex, NoMaterial>(path::resources() + "models/lighting/PointLightVolume.obj")[0];
-    mVao = mesh.renderInformation.vao;
-    mEboCount = mesh.renderInformation.eboCount;
-    mEbo = mesh.ebo;
-    mVbo = mesh.vbo;
-    
     mEntities.forEach([this](const light::PointLight &pointLight, const Position &position) {
-        const glm::mat4 positionMatrix = glm::translate(glm::mat4(1.f), position.value);
-        const glm::mat4 scaleMatrix = glm::scale(glm::mat4(1.f), glm::vec3(pointLight.distance));
-        const glm::mat4 mvp = mCamera->getVpMatrix() * positionMatrix * scaleMatrix;
-        
-        mShader.set("u_mvp_matrix", mCamera->getVpMatrix() * positionMatrix * scaleMatrix);
-        mShader.set("u_light_position",  position.value);
-        mShader.set("u_light_intensity", pointLight.intensity);
-        mShader.set("u_light_distance",  pointLight.distance);
-        mShader.set("u_light_power",     pointLight.power);
-    
-        // The model has inverted faces!
-        // Point lights are always rendered backwards (so you can go inside the mesh).
-        glDrawElements(GL_TRIANGLES, mEboCount, GL_UNSIGNED_INT, 0);
+        if (mClusteredLighting->isEnabled())
+            mClusteredLighting->add(position.value, pointLight);
+        else if (mInstancedLightVolumes->isEnabled())
+            mInstancedLightVolumes->add(position.value, pointLight);
+        else
+            mLightVolumes->add(position.value, pointLight);
     });
     scheduleFor(ecs::Render);
 }
-
-PointLightShader::~PointLightShader()
-{
-
-}
-
-void PointLightShader::onUpdate()
-{
-    bind();
-}
-
-void PointLightShader::bind()
-{
-    mShader.bind();
-    mLightAccumulationBuffer->bind();
-    
-    mShader.set("u_positions", mPositions->getName(), 0);
-    mShader.set("u_normals",   mNormals->getName(),   1);
-    mShader.set("u_albedo",    mAlbedo->getName(),    2);
-    
-    mShader.set("u_mvp_matrix", glm::mat4(1.f));
-    mShader.set("u_camera_position_ws", mCamera->getPosition());
-    
-    glBindVertexArray(mVao);
-}
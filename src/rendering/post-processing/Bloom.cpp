@@ -8,24 +8,18 @@
 #include "Bloom.h"
 #include "Vertices.h"
 #include "Primitives.h"
+#include "ModelDestroyer.h"
 #include "FilePaths.h"
 #include "imgui.h"
 #include "gtc/type_ptr.hpp"
 
 Bloom::Bloom()
 {
-    const auto mesh = primitives::plane<UvVertex>()[0];
-    mVao      = mesh.renderInformation.vao;
-    mEboCount = mesh.renderInformation.eboCount;
-    mEbo      = mesh.ebo;
-    mVbo      = mesh.vbo;
 }
 
 Bloom::~Bloom()
 {
-    glDeleteVertexArrays(1, &mVao);
-    glDeleteBuffers(1, &mEbo);
-    glDeleteBuffers(1, &mVbo);
+    destroy::mesh(mQuad);
 }
 
 void Bloom::preFilter(TextureBufferObject *input, FramebufferObject *output)
@@ -33,12 +27,12 @@ void Bloom::preFilter(TextureBufferObject *input, FramebufferObject *output)
     mPreFilter.bind();
     output->bind();
     
-    mPreFilter.set("u_mvp_matrix", glm::mat4(1.f));
-    mPreFilter.set("u_light_key_threshold", mBloomThreshold);
-    mPreFilter.set("u_texture", input->getName(), 0);
+    mPreFilterMvp.set(glm::mat4(1.f));
+    mPreFilterThreshold.set(mBloomThreshold);
+    mPreFilterTexture.set({ input->getName(), 0 });
     
-    glBindVertexArray(mVao);
-    glDrawElements(GL_TRIANGLES, mEboCount, GL_UNSIGNED_INT, 0);
+    glBindVertexArray(mQuad.renderInformation.vao);
+    drawElements(mQuad.renderInformation);
 }
 
 void Bloom::downSample(TextureBufferObject *input, const int mipLevel, FramebufferObject *output)
@@ -46,13 +40,13 @@ void Bloom::downSample(TextureBufferObject *input, const int mipLevel, Framebuff
     mDownSample.bind();
     output->bind();
     
-    mDownSample.set("u_mvp_matrix", glm::mat4(1.f));
-    mDownSample.set("u_mip_level", mipLevel);
-    mDownSample.set("u_mip_size", output->getSize());
-    mDownSample.set("u_texture", input->getName(), 0);
+    mDownSampleMvp.set(glm::mat4(1.f));
+    mDownSampleMipLevel.set(mipLevel);
+    mDownSampleMipSize.set(glm::vec2(output->getSize()));
+    mDownSampleTexture.set({ input->getName(), 0 });
     
-    glBindVertexArray(mVao);
-    glDrawElements(GL_TRIANGLES, mEboCount, GL_UNSIGNED_INT, 0);
+    glBindVertexArray(mQuad.renderInformation.vao);
+    drawElements(mQuad.renderInformation);
 }
 
 void Bloom::upSample(
@@ -63,21 +57,21 @@ void Bloom::upSample(
     mUpSample.bind();
     output->bind();
     
-    mUpSample.set("u_mvp_matrix", glm::mat4(1.f));
-    mUpSample.set("u_up_mip_level", upSampleMipLevel);
-    mUpSample.set("u_down_mip_level", downSampleMipLevel);
-    mUpSample.set("u_mip_size", output->getSize() / 2);
-    mUpSample.set("u_scale", mBloomScale);
+    mUpSampleMvp.set(glm::mat4(1.f));
+    mUpSampleUpMipLevel.set(upSampleMipLevel);
+    mUpSampleDownMipLevel.set(downSampleMipLevel);
+    mUpSampleMipSize.set(glm::vec2(output->getSize() / 2));
+    mUpSampleScale.set(mBloomScale);
     
     auto downSampleSize = downSample->getSize() / static_cast<int>(glm::pow(2, downSampleMipLevel));
     if (output->getSize() != downSampleSize)
         debug::log("Not the same size!");
     
-    mUpSample.set("u_up_sample_texture", lastUpSample->getName(), 0);
-    mUpSample.set("u_down_sample_texture", downSample->getName(), 1);
+    mUpSampleUpTexture.set({ lastUpSample->getName(), 0 });
+    mUpSampleDownTexture.set({ downSample->getName(), 1 });
     
-    glBindVertexArray(mVao);
-    glDrawElements(GL_TRIANGLES, mEboCount, GL_UNSIGNED_INT, 0);
+    glBindVertexArray(mQuad.renderInformation.vao);
+    drawElements(mQuad.renderInformation);
 }
 
 void Bloom::imGuiUpdate()
@@ -92,11 +86,11 @@ void Bloom::composite(TextureBufferObject *original, TextureBufferObject *bloom,
     mComposite.bind();
     output->bind();
     
-    mComposite.set("u_mvp_matrix", glm::mat4(1.f));
-    mComposite.set("u_original", original->getName(), 0);
-    mComposite.set("u_bloom", bloom->getName(), 1);
-    mComposite.set("u_exposure", mExposure);
+    mCompositeMvp.set(glm::mat4(1.f));
+    mCompositeOriginal.set({ original->getName(), 0 });
+    mCompositeBloom.set({ bloom->getName(), 1 });
+    mCompositeExposure.set(mExposure);
     
-    glBindVertexArray(mVao);
-    glDrawElements(GL_TRIANGLES, mEboCount, GL_UNSIGNED_INT, 0);
+    glBindVertexArray(mQuad.renderInformation.vao);
+    drawElements(mQuad.renderInformation);
 }
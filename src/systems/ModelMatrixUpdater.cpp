@@ -6,16 +6,111 @@
 
 
 #include "ModelMatrixUpdater.h"
-#include "gtc/quaternion.hpp"
+#include "ParallelForEach.h"
+#include "Timers.h"
 
-ModelMatrixUpdater::ModelMatrixUpdater()
+ModelMatrixUpdater::ModelMatrixUpdater(
+    std::shared_ptr<TransformHierarchy> hierarchy, std::shared_ptr<TransformSnapshots> snapshots)
+    : mHierarchy(std::move(hierarchy)), mSnapshots(std::move(snapshots))
 {
-    mEntities.forEach([](std::shared_ptr<ModelMatrix> &modelMatrix, const Transform &transform) {
-        const glm::mat4 scale    = glm::scale(glm::mat4(1.f), transform.scale);
-        const glm::mat4 rotation = glm::mat4(transform.rotation);
-        const glm::mat4 position = glm::translate(glm::mat4(1.f), transform.position);
-    
-        modelMatrix->value = position * rotation * scale;
+    mEntities.forEach([this](const TransformNode &node, const Position &position, const Rotation &rotation, const Scale &scale) {
+        update(mSnapshots.get(), *mHierarchy, node, position, rotation, scale);
     });
     scheduleFor(ecs::Update);
 }
+
+void ModelMatrixUpdater::update(
+    const TransformSnapshots *snapshots, TransformHierarchy &hierarchy, const TransformNode node,
+    const Position &position, const Rotation &rotation, const Scale &scale)
+{
+    if (hierarchy.isStatic(node))
+        return;
+    
+    if (snapshots)
+    {
+        // The live transform belongs to the fixed update, so a node that has not been ticked yet keeps the
+        // transform it was made with.
+        Transform interpolated;
+        if (snapshots->interpolate(node, interpolated))
+            hierarchy.setLocal(node, interpolated);
+        return;
+    }
+    
+    hierarchy.setLocal(node, Transform { position.value, rotation.value, scale.value });
+}
+
+void createParallelModelMatrixUpdater(
+    ecs::Core &ecs, std::shared_ptr<TransformHierarchy> hierarchy, std::shared_ptr<TransformSnapshots> snapshots,
+    const uint32_t grainSize, WorkStealingPool *pool)
+{
+    // Interpolating only reads from the snapshots and every entity sets a different node, so any number of threads
+    // can share them.
+    createParallelSystem<const TransformNode, const Position, const Rotation, const Scale>(ecs, ecs::Update, grainSize,
+        [hierarchy, snapshots = std::move(snapshots)](
+            const TransformNode &node, const Position &position, const Rotation &rotation, const Scale &scale) {
+            ModelMatrixUpdater::update(snapshots.get(), *hierarchy, node, position, rotation, scale);
+        }, pool);
+    ecs.createSystem<TransformHierarchyUpdater>(std::move(hierarchy), ecs::Update, pool);
+}
+
+ModelMatrixBenchmark benchmarkModelMatrixUpdater(const uint32_t entityCount, const uint32_t steps)
+{
+    const auto createEntities = [entityCount](ecs::Core &ecs, TransformHierarchy &hierarchy) {
+        std::vector<Entity> entities;
+        entities.reserve(entityCount);
+        for (uint32_t i = 0; i < entityCount; ++i)
+        {
+            const Transform transform {
+                glm::vec3(static_cast<float>(i % 100), 0.f, static_cast<float>(i / 100)),
+                glm::quat(glm::vec3(0.f, static_cast<float>(i) * 0.01f, 0.f)) };
+            
+            Entity entity = ecs.create();
+            ecs.add(entity, Position { transform.position });
+            ecs.add(entity, Rotation { transform.rotation });
+            ecs.add(entity, Scale { transform.scale });
+            ecs.add(entity, hierarchy.create(transform));
+            entities.emplace_back(entity);
+        }
+        return entities;
+    };
+    
+    // Nudging every transform first means that no matrix can be skipped. Only the update is timed.
+    const auto updateMs = [steps](ecs::Core &ecs, const std::vector<Entity> &entities, const bool moveTransforms) {
+        double totalMs = 0.0;
+        for (uint32_t i = 0; i < steps; ++i)
+        {
+            if (moveTransforms)
+            {
+                for (const Entity &entity : entities)
+                    ecs.getComponent<Position>(entity).value.y += 0.01f;
+            }
+            totalMs += timers::measure([&]() { ecs.update(); });
+        }
+        return totalMs / steps;
+    };
+    
+    ModelMatrixBenchmark result { entityCount };
+    {
+        WorkStealingPool serialPool(0);
+        auto hierarchy = std::make_shared<TransformHierarchy>();
+        ecs::Core ecs { ecs::initFlag::AutoInitialise };
+        const std::vector<Entity> entities = createEntities(ecs, *hierarchy);
+        ecs.createSystem<ModelMatrixUpdater>(hierarchy);
+        ecs.createSystem<TransformHierarchyUpdater>(hierarchy, ecs::Update, &serialPool);
+        result.serialMs = updateMs(ecs, entities, true);
+        result.unchangedMs = updateMs(ecs, entities, false);
+    }
+    
+    const uint32_t maxWorkers = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+    for (uint32_t workers = 1; workers <= maxWorkers; workers *= 2)
+    {
+        WorkStealingPool pool(workers);
+        auto hierarchy = std::make_shared<TransformHierarchy>();
+        ecs::Core ecs { ecs::initFlag::AutoInitialise };
+        const std::vector<Entity> entities = createEntities(ecs, *hierarchy);
+        createParallelModelMatrixUpdater(ecs, hierarchy, nullptr, 1024, &pool);
+        result.parallelMs.emplace_back(workers, updateMs(ecs, entities, true));
+    }
+    
+    return result;
+}
@@ -0,0 +1,40 @@
+/**
+ * @file ModelSpawner.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "ModelSpawner.h"
+#include "MaterialComponents.h"
+#include "Timers.h"
+
+ModelSpawnBenchmark benchmarkModelSpawn(const uint32_t modelCount, const uint32_t slotCount)
+{
+    std::vector<Transform> transforms;
+    transforms.reserve(modelCount);
+    for (uint32_t i = 0; i < modelCount; ++i)
+        transforms.push_back({ glm::vec3(static_cast<float>(i % 100), 0.f, static_cast<float>(i / 100)) });
+    
+    const auto modelsPerMs = [modelCount, slotCount](auto &&spawnAll) {
+        ecs::Core ecs { ecs::initFlag::AutoInitialise };
+        TransformHierarchy hierarchy;
+        
+        ModelPrefab<BlinnPhongMaterial> prefab { ecs.create<RenderInformation>() };
+        prefab.renderInformation.resize(slotCount);
+        prefab.materials.resize(slotCount);
+        
+        return timers::itemsPerMs(modelCount, 1, [&]() { spawnAll(ecs, hierarchy, prefab); });
+    };
+    
+    ModelSpawnBenchmark result { modelCount };
+    result.singleModelsPerMs = modelsPerMs([&](ecs::Core &ecs, TransformHierarchy &hierarchy, const auto &prefab) {
+        for (const Transform &transform : transforms)
+            spawn::model(ecs, hierarchy, prefab, transform);
+    });
+    result.bulkModelsPerMs = modelsPerMs([&](ecs::Core &ecs, TransformHierarchy &hierarchy, const auto &prefab) {
+        spawn::models(ecs, hierarchy, prefab, transforms);
+    });
+    
+    return result;
+}
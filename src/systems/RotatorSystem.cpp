@@ -10,11 +10,16 @@
 
 RotatorSystem::RotatorSystem()
 {
-    mEntities.forEach([](Rotator &rotator, Transform &transform) {
-        rotator.time += timers::deltaTime<float>();
-        const auto timeSin = glm::sin(rotator.time);
-        
-        transform.rotation = glm::quat(glm::vec3(rotator.time));
-        transform.position.y = timeSin * rotator.height + rotator.originalHeight.y;
+    mEntities.forEach([](Rotator &rotator, Position &position, Rotation &rotation) {
+        update(rotator, position, rotation, timers::deltaTime<float>());
     });
+}
+
+void RotatorSystem::update(Rotator &rotator, Position &position, Rotation &rotation, const float deltaTime)
+{
+    rotator.time += deltaTime;
+    const auto timeSin = glm::sin(rotator.time);
+    
+    rotation.value = glm::quat(glm::vec3(rotator.time));
+    position.value.y = timeSin * rotator.height + rotator.originalHeight.y;
 }
\ No newline at end of file
@@ -0,0 +1,151 @@
+/**
+ * @file SystemScheduler.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "SystemScheduler.h"
+#include "Timers.h"
+#include "imgui.h"
+
+SystemScheduler::SystemScheduler(ecs::Core &ecs, const SystemSchedule gatherStage, WorkStealingPool *pool)
+    : mEcs(ecs), mGatherStage(gatherStage), mPool(pool)
+{
+}
+
+void SystemScheduler::run()
+{
+    if (!mHasHazards)
+        findHazards();
+    
+    for (Job &job : mJobs)
+        job.footprints = job.findFootprints();
+    buildWaves();
+    
+    // The fixed time is thread local, so it is read here rather than by the workers.
+    const auto deltaTime = timers::fixedTime<float>();
+    for (const std::vector<uint32_t> &wave : mWaves)
+    {
+        mPool->parallelFor(static_cast<uint32_t>(wave.size()), 1, [&](const uint32_t first, const uint32_t last) {
+            for (uint32_t i = first; i < last; ++i)
+            {
+                Job &job = mJobs[wave[i]];
+                job.milliseconds = timers::measure([&]() { job.run(deltaTime); });
+            }
+        });
+    }
+}
+
+void SystemScheduler::findHazards()
+{
+    mDependencies.clear();
+    
+    const auto contains = [](const std::vector<std::type_index> &types, const std::type_index &type) {
+        return std::find(types.begin(), types.end(), type) != types.end();
+    };
+    
+    for (uint32_t later = 0; later < mJobs.size(); ++later)
+    {
+        const Job &job = mJobs[later];
+        for (uint32_t earlier = 0; earlier < later; ++earlier)
+        {
+            const Job &other = mJobs[earlier];
+            
+            // Write after write, read after write and write after read. Creation order is kept for these only.
+            const auto isHazard = [&](const std::type_index &component) {
+                return contains(other.writes, component)
+                    ? contains(job.writes, component) || contains(job.reads, component)
+                    : contains(job.writes, component);
+            };
+            
+            std::vector<std::type_index> components = other.writes;
+            components.insert(components.end(), other.reads.begin(), other.reads.end());
+            for (const std::type_index &component : components)
+            {
+                if (isHazard(component))
+                    mDependencies.push_back({ earlier, later, component });
+            }
+        }
+    }
+    
+    mHasHazards = true;
+}
+
+void SystemScheduler::buildWaves()
+{
+    const auto footprintOf = [](const Job &job, const std::type_index &component) {
+        return *std::find_if(job.footprints.begin(), job.footprints.end(), [&](const Footprint &footprint) {
+            return footprint.component == component;
+        });
+    };
+    
+    for (Dependency &dependency : mDependencies)
+    {
+        const Footprint from = footprintOf(mJobs[dependency.from], dependency.component);
+        dependency.isActive = from.overlaps(footprintOf(mJobs[dependency.to], dependency.component));
+    }
+    
+    // Dependencies only ever point forwards, so every job's wave is known before any job that waits for it.
+    for (Job &job : mJobs)
+        job.wave = 0;
+    for (const Dependency &dependency : mDependencies)
+    {
+        if (dependency.isActive)
+            mJobs[dependency.to].wave = std::max(mJobs[dependency.to].wave, mJobs[dependency.from].wave + 1);
+    }
+    
+    mWaves.clear();
+    for (uint32_t i = 0; i < mJobs.size(); ++i)
+    {
+        if (mJobs[i].wave >= mWaves.size())
+            mWaves.resize(mJobs[i].wave + 1);
+        mWaves[mJobs[i].wave].push_back(i);
+    }
+}
+
+void SystemScheduler::imguiUpdate() const
+{
+    for (uint32_t wave = 0; wave < mWaves.size(); ++wave)
+    {
+        ImGui::Text("Wave %u", wave);
+        for (const uint32_t index : mWaves[wave])
+        {
+            const Job &job = mJobs[index];
+            ImGui::BulletText("%s - %u entities, %.3fms", job.name.c_str(), job.size(), job.milliseconds);
+        }
+    }
+    
+    if (mDependencies.empty())
+        return;
+    
+    ImGui::Separator();
+    ImGui::TextUnformatted("Dependencies");
+    for (const auto &[from, to, component, isActive] : mDependencies)
+    {
+        ImGui::BulletText(
+            "%s -> %s (%s)%s", mJobs[from].name.c_str(), mJobs[to].name.c_str(), component.name(),
+            isActive ? "" : " - disjoint entities");
+    }
+}
+
+void SystemScheduler::Footprint::include(const void *address, const std::size_t size)
+{
+    const auto begin = reinterpret_cast<uintptr_t>(address);
+    first = std::min(first, begin);
+    last = std::max(last, begin + size);
+}
+
+bool SystemScheduler::Footprint::overlaps(const Footprint &other) const
+{
+    return first < other.last && other.first < last;
+}
+
+SchedulerDispatch::SchedulerDispatch(std::shared_ptr<SystemScheduler> scheduler, const SystemSchedule schedule)
+    : mScheduler(std::move(scheduler))
+{
+    mEntities.forEach([this](SchedulerEntity &) {
+        mScheduler->run();
+    });
+    scheduleFor(schedule);
+}
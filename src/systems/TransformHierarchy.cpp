@@ -0,0 +1,263 @@
+/**
+ * @file TransformHierarchy.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "TransformHierarchy.h"
+#include "Timers.h"
+#include "gtc/quaternion.hpp"
+#include "ext/matrix_transform.hpp"
+
+#include <array>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+glm::mat4 TransformHierarchy::localMatrix(const Transform &transform)
+{
+    const glm::mat3 rotation = glm::mat3_cast(transform.rotation);
+    
+    return glm::mat4(
+        glm::vec4(rotation[0] * transform.scale.x, 0.f),
+        glm::vec4(rotation[1] * transform.scale.y, 0.f),
+        glm::vec4(rotation[2] * transform.scale.z, 0.f),
+        glm::vec4(transform.position, 1.f));
+}
+
+TransformNode TransformHierarchy::create(const Transform &local, const std::optional<TransformNode> parent)
+{
+    const TransformNode node { size() };
+    const glm::mat4 matrix = localMatrix(local);
+    
+    mParents.emplace_back(parent.has_value() ? parent->index : noParent);
+    mLocal.emplace_back(local);
+    mSource.emplace_back(local);
+    mLocalMatrices.emplace_back(matrix);
+    mWorld.emplace_back(parent.has_value() ? mWorld[parent->index] * matrix : matrix);
+    mChanged.emplace_back(false);
+    mStatic.emplace_back(false);
+    
+    if (parent.has_value())
+        mChildren.emplace_back(node.index);
+    
+    return node;
+}
+
+void TransformHierarchy::reserve(const uint32_t count)
+{
+    mParents.reserve(count);
+    mLocal.reserve(count);
+    mSource.reserve(count);
+    mLocalMatrices.reserve(count);
+    mWorld.reserve(count);
+    mChanged.reserve(count);
+    mStatic.reserve(count);
+}
+
+void TransformHierarchy::makeStatic(const TransformNode node)
+{
+    const uint32_t i = node.index;
+    mSource[i] = mLocal[i];
+    mLocalMatrices[i] = localMatrix(mLocal[i]);
+    mWorld[i] = mParents[i] == noParent ? mLocalMatrices[i] : mWorld[mParents[i]] * mLocalMatrices[i];
+    mChanged[i] = false;
+    mStatic[i] = true;
+}
+
+void TransformHierarchy::mirror(const TransformHierarchy &source)
+{
+    const uint32_t first = size();
+    reserve(source.size());
+    for (uint32_t i = first; i < source.size(); ++i)
+    {
+        mParents.emplace_back(source.mParents[i]);
+        mLocal.emplace_back(source.mLocal[i]);
+        mSource.emplace_back(source.mSource[i]);
+        mLocalMatrices.emplace_back(source.mLocalMatrices[i]);
+        mWorld.emplace_back(source.mWorld[i]);
+        mChanged.emplace_back(false);
+        mStatic.emplace_back(source.mStatic[i]);
+        
+        if (source.mParents[i] != noParent)
+            mChildren.emplace_back(i);
+    }
+    
+    // Static nodes are never updated again, so their matrices have to come from source.
+    for (uint32_t i = 0; i < first; ++i)
+    {
+        if (mStatic[i] || !source.mStatic[i])
+            continue;
+        
+        mLocal[i] = source.mLocal[i];
+        mSource[i] = source.mSource[i];
+        mLocalMatrices[i] = source.mLocalMatrices[i];
+        mWorld[i] = source.mWorld[i];
+        mChanged[i] = false;
+        mStatic[i] = true;
+    }
+}
+
+void TransformHierarchy::update(WorkStealingPool *pool, const uint32_t grainSize)
+{
+    // Roots do not depend on anything else, so their world matrix is finished here.
+    pool->parallelFor(size(), grainSize, [this](const uint32_t first, const uint32_t last) {
+        for (uint32_t i = first; i < last; ++i)
+        {
+            mChanged[i] = !mStatic[i] && mLocal[i] != mSource[i];
+            if (!mChanged[i])
+                continue;
+            
+            mSource[i] = mLocal[i];
+            mLocalMatrices[i] = localMatrix(mLocal[i]);
+            if (mParents[i] == noParent)
+                mWorld[i] = mLocalMatrices[i];
+        }
+    });
+    
+    // Parents come first, so a change has always reached the parent by the time its children are visited.
+    for (const uint32_t child : mChildren)
+    {
+        const uint32_t parent = mParents[child];
+        if (mStatic[child] || (!mChanged[child] && !mChanged[parent]))
+            continue;
+        
+        mWorld[child] = mWorld[parent] * mLocalMatrices[child];
+        mChanged[child] = true;
+    }
+}
+
+TransformHierarchyUpdater::TransformHierarchyUpdater(
+    std::shared_ptr<TransformHierarchy> hierarchy, const SystemSchedule schedule, WorkStealingPool *pool)
+    : mHierarchy(std::move(hierarchy)), mPool(pool)
+{
+    // All the work is done in onUpdate().
+    mEntities.forEach([](TransformNode &) {});
+    scheduleFor(schedule);
+}
+
+void TransformHierarchyUpdater::onUpdate()
+{
+    mHierarchy->update(mPool);
+}
+
+namespace
+{
+    /** The layout of a model matrix when every model kept its own one on the heap behind a std::shared_ptr. */
+    struct HeapModelMatrix
+    {
+        glm::mat4   value       { 1.f };
+        Transform   source;
+        bool        isStatic    { false };
+    };
+    
+    /**
+     * @brief Runs function once.
+     * @returns The last level cache misses of the calling thread while it ran, if the hardware counters can be read.
+     */
+    template<typename TFunction>
+    std::optional<uint64_t> countCacheMisses(TFunction &&function)
+    {
+#ifdef __linux__
+        perf_event_attr attributes {};
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.size = sizeof(perf_event_attr);
+        attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        
+        const int file = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+        if (file >= 0)
+        {
+            ioctl(file, PERF_EVENT_IOC_RESET, 0);
+            ioctl(file, PERF_EVENT_IOC_ENABLE, 0);
+            function();
+            ioctl(file, PERF_EVENT_IOC_DISABLE, 0);
+            
+            uint64_t misses = 0;
+            const bool hasRead = read(file, &misses, sizeof(misses)) == sizeof(misses);
+            close(file);
+            return hasRead ? std::optional<uint64_t>(misses) : std::nullopt;
+        }
+#endif
+        function();
+        return std::nullopt;
+    }
+}
+
+GeometryPassBenchmark benchmarkGeometryPass(const uint32_t slotCount, const uint32_t steps)
+{
+    // Most of the models in the scenes are made of a handful of meshes.
+    constexpr uint32_t slotsPerModel = 4;
+    const uint32_t modelCount = (slotCount + slotsPerModel - 1) / slotsPerModel;
+    
+    const auto modelTransform = [](const uint32_t model) {
+        return Transform {
+            glm::vec3(static_cast<float>(model % 100), 0.f, static_cast<float>(model / 100)),
+            glm::quat(glm::vec3(0.f, static_cast<float>(model) * 0.01f, 0.f)) };
+    };
+    
+    // Loading a model also allocates its meshes, materials and colliders, so the matrices were never next to each other.
+    std::vector<std::shared_ptr<HeapModelMatrix>> sharedSlots;
+    std::vector<std::shared_ptr<std::array<std::byte, 256>>> otherAllocations;
+    sharedSlots.reserve(slotCount);
+    otherAllocations.reserve(modelCount);
+    
+    TransformHierarchy hierarchy;
+    std::vector<TransformNode> hierarchySlots;
+    hierarchySlots.reserve(slotCount);
+    
+    for (uint32_t model = 0; model < modelCount; ++model)
+    {
+        const Transform transform = modelTransform(model);
+        auto modelMatrix = std::make_shared<HeapModelMatrix>();
+        modelMatrix->value = TransformHierarchy::localMatrix(transform);
+        modelMatrix->source = transform;
+        otherAllocations.emplace_back(std::make_shared<std::array<std::byte, 256>>());
+        
+        const TransformNode node = hierarchy.create(transform);
+        for (uint32_t slot = 0; slot < slotsPerModel && sharedSlots.size() < slotCount; ++slot)
+        {
+            sharedSlots.emplace_back(modelMatrix);
+            hierarchySlots.emplace_back(node);
+        }
+    }
+    
+    const glm::mat4 viewProjection = glm::translate(glm::mat4(1.f), glm::vec3(0.f, -10.f, -15.f));
+    glm::mat4 sink { 0.f };
+    
+    const auto sharedPointerPass = [&]() {
+        for (const std::shared_ptr<HeapModelMatrix> &modelMatrix : sharedSlots)
+            sink += viewProjection * modelMatrix->value;
+    };
+    
+    const auto hierarchyPass = [&]() {
+        for (const TransformNode node : hierarchySlots)
+            sink += viewProjection * hierarchy.world(node);
+    };
+    
+    const auto passMs = [steps](const auto &pass) {
+        return timers::measure([&]() {
+            for (uint32_t i = 0; i < steps; ++i)
+                pass();
+        }) / steps;
+    };
+    
+    GeometryPassBenchmark result { slotCount };
+    result.sharedPointerMisses = countCacheMisses(sharedPointerPass);
+    result.sharedPointerMs = passMs(sharedPointerPass);
+    result.hierarchyMisses = countCacheMisses(hierarchyPass);
+    result.hierarchyMs = passMs(hierarchyPass);
+    
+    // Stops the passes from being optimised away.
+    volatile float keep = sink[0][0];
+    static_cast<void>(keep);
+    
+    return result;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file TransformSnapshots.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "TransformSnapshots.h"
+#include "Timers.h"
+#include "gtc/quaternion.hpp"
+
+void TransformSnapshots::write(const TransformNode node, const Transform &transform)
+{
+    if (node.index >= mNext.transforms.size())
+        mNext.transforms.resize(node.index + 1);
+    
+    mNext.transforms[node.index] = transform;
+}
+
+void TransformSnapshots::publish()
+{
+    mNext.time = timers::getTicks<double>();
+    
+    // Every node is written again each tick, so whichever buffer comes back can be written over as it is.
+    std::scoped_lock lock(mMutex);
+    std::swap(mPublished, mNext);
+    mIsPublished = true;
+}
+
+void TransformSnapshots::acquire()
+{
+    std::scoped_lock lock(mMutex);
+    if (!mIsPublished)
+        return;
+    
+    // Rotating the buffers keeps the memory of each one alive between ticks.
+    std::swap(mPrevious, mCurrent);
+    std::swap(mCurrent, mPublished);
+    mIsPublished = false;
+}
+
+bool TransformSnapshots::interpolate(const TransformNode node, Transform &transform) const
+{
+    if (node.index >= mPrevious.transforms.size() || node.index >= mCurrent.transforms.size())
+        return false;
+    
+    const Transform &previous = mPrevious.transforms[node.index];
+    const Transform &current = mCurrent.transforms[node.index];
+    
+    // Most things are at rest, so skip the slerp and leave the hierarchy able to see that nothing has changed.
+    if (previous == current)
+    {
+        transform = current;
+        return true;
+    }
+    
+    const float alpha = glm::clamp(
+        static_cast<float>((timers::getTicks<double>() - mCurrent.time) / timers::fixedTime<double>()), 0.f, 1.f);
+    
+    transform.position = glm::mix(previous.position, current.position, alpha);
+    transform.rotation = glm::slerp(previous.rotation, current.rotation, alpha);
+    transform.scale    = glm::mix(previous.scale, current.scale, alpha);
+    return true;
+}
+
+TransformSnapshotWriter::TransformSnapshotWriter(
+    std::shared_ptr<TransformSnapshots> snapshots, std::shared_ptr<TransformHierarchy> hierarchy)
+    : mSnapshots(std::move(snapshots)), mHierarchy(std::move(hierarchy))
+{
+    mEntities.forEach([this](const TransformNode &node, const Position &position, const Rotation &rotation, const Scale &scale) {
+        if (mHierarchy->isStatic(node))
+            return;
+        
+        const Transform transform { position.value, rotation.value, scale.value };
+        mSnapshots->write(node, transform);
+        mHierarchy->setLocal(node, transform);
+    });
+    scheduleFor(ecs::PreFixedUpdate);
+}
@@ -0,0 +1,118 @@
+/**
+ * @file TransformStreams.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "TransformStreams.h"
+#include "Components.h"
+#include "Physics.h"
+#include "PhysicsSystems.h"
+#include "RotatorSystem.h"
+#include "ModelMatrixUpdater.h"
+#include "TransformHierarchy.h"
+#include "Timers.h"
+
+TransformStreamBenchmark benchmarkTransformStreams(const uint32_t entityCount, const uint32_t steps)
+{
+    const float fixedTime = timers::fixedTime<float>();
+    
+    std::vector<Transform> transforms;
+    std::vector<Position> positions;
+    std::vector<Rotation> rotations;
+    std::vector<Scale> scales;
+    
+    std::vector<DynamicObject> dynamicObjects(entityCount);
+    std::vector<Velocity> velocities(entityCount);
+    std::vector<Torque> torques(entityCount);
+    std::vector<AngularObject> angularObjects(entityCount);
+    std::vector<AngularVelocity> angularVelocities(entityCount);
+    std::vector<Rotator> rotators(entityCount);
+    
+    TransformHierarchy hierarchy;
+    std::vector<TransformNode> nodes;
+    nodes.reserve(entityCount);
+    
+    for (uint32_t i = 0; i < entityCount; ++i)
+    {
+        const Transform transform {
+            glm::vec3(static_cast<float>(i % 100), 5.f, static_cast<float>(i / 100)),
+            glm::quat(glm::vec3(0.f, static_cast<float>(i) * 0.01f, 0.f)) };
+        
+        transforms.emplace_back(transform);
+        positions.push_back({ transform.position });
+        rotations.push_back({ transform.rotation });
+        scales.push_back({ transform.scale });
+        nodes.emplace_back(hierarchy.create(transform));
+        
+        dynamicObjects[i].mass = 100.f;
+        
+        // A box with a different inertia around each axis that is spinning, so no body takes the early out.
+        angularObjects[i].inverseBodyInertia = glm::mat3(
+            1.f, 0.f,       0.f,
+            0.f, 1.f / 2.f, 0.f,
+            0.f, 0.f,       1.f / 3.f);
+        angularObjects[i].angularMomentum = glm::vec3(0.2f, 0.2f, 5.f);
+        
+        rotators[i].height = 1.f;
+        rotators[i].originalHeight = transform.position;
+    }
+    
+    TransformStreamBenchmark result { entityCount };
+    
+    // The transform versions are how each system was written before the transform was split.
+    auto &linear = result.systems.emplace_back(TransformStreamBenchmark::System { "Linear Euler" });
+    linear.transformEntitiesPerMs = timers::itemsPerMs(entityCount, steps, [&]() {
+        for (uint32_t i = 0; i < entityCount; ++i)
+        {
+            auto &[force, mass, momentum] = dynamicObjects[i];
+            physics::rungeKutta<tableau::Euler>(transforms[i].position, momentum, force, mass, fixedTime);
+            velocities[i].value = momentum / mass;
+            force = glm::vec3(0.f);
+        }
+    });
+    linear.streamEntitiesPerMs = timers::itemsPerMs(entityCount, steps, [&]() {
+        for (uint32_t i = 0; i < entityCount; ++i)
+            LinearEulerMethod::integrate(dynamicObjects[i], velocities[i], positions[i]);
+    });
+    
+    auto &angular = result.systems.emplace_back(TransformStreamBenchmark::System { "Angular Quaternion" });
+    angular.transformEntitiesPerMs = timers::itemsPerMs(entityCount, steps, [&]() {
+        for (uint32_t i = 0; i < entityCount; ++i)
+            AngularQuaternionMethod::integrate(torques[i], angularObjects[i], angularVelocities[i], transforms[i].rotation, false);
+    });
+    angular.streamEntitiesPerMs = timers::itemsPerMs(entityCount, steps, [&]() {
+        for (uint32_t i = 0; i < entityCount; ++i)
+            AngularQuaternionMethod::integrate(torques[i], angularObjects[i], angularVelocities[i], rotations[i].value, false);
+    });
+    
+    auto &rotator = result.systems.emplace_back(TransformStreamBenchmark::System { "Rotator" });
+    rotator.transformEntitiesPerMs = timers::itemsPerMs(entityCount, steps, [&]() {
+        for (uint32_t i = 0; i < entityCount; ++i)
+        {
+            rotators[i].time += fixedTime;
+            transforms[i].rotation = glm::quat(glm::vec3(rotators[i].time));
+            transforms[i].position.y = glm::sin(rotators[i].time) * rotators[i].height + rotators[i].originalHeight.y;
+        }
+    });
+    rotator.streamEntitiesPerMs = timers::itemsPerMs(entityCount, steps, [&]() {
+        for (uint32_t i = 0; i < entityCount; ++i)
+            RotatorSystem::update(rotators[i], positions[i], rotations[i], fixedTime);
+    });
+    
+    auto &modelMatrix = result.systems.emplace_back(TransformStreamBenchmark::System { "Model Matrix" });
+    modelMatrix.transformEntitiesPerMs = timers::itemsPerMs(entityCount, steps, [&]() {
+        for (uint32_t i = 0; i < entityCount; ++i)
+        {
+            if (!hierarchy.isStatic(nodes[i]))
+                hierarchy.setLocal(nodes[i], transforms[i]);
+        }
+    });
+    modelMatrix.streamEntitiesPerMs = timers::itemsPerMs(entityCount, steps, [&]() {
+        for (uint32_t i = 0; i < entityCount; ++i)
+            ModelMatrixUpdater::update(nullptr, hierarchy, nodes[i], positions[i], rotations[i], scales[i]);
+    });
+    
+    return result;
+}
@@ -0,0 +1,224 @@
+/**
+ * @file CullTest.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "Pch.h"
+#include "GeometryBatch.h"
+#include "Shader.h"
+#include "FilePaths.h"
+#include "gtc/matrix_transform.hpp"
+#include "TestHelpers.h"
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+/**
+ * Runs Cull.comp on an OpenGL 4.5 core context with no window or surface (Mesa's llvmpipe is enough, so it runs on
+ * headless machines) against instances and a hierarchical depth pyramid whose results are known, and checks the
+ * counters and instance count it writes. Returns skipCode if there is no EGL driver to make a context with.
+ */
+namespace
+{
+    constexpr int skipCode          { 77 };
+    constexpr int pyramidSize       { 64 };
+    constexpr int groupSize         { 64 };  // Must match local_size_x in Cull.comp.
+    
+    /** Matches the std140 Camera block that Cull.comp reads at binding 0. */
+    struct CameraBlock
+    {
+        glm::mat4 viewProjection;
+        glm::vec4 position;
+    };
+    
+    struct Context
+    {
+        EGLDisplay display { EGL_NO_DISPLAY };
+        EGLContext context { EGL_NO_CONTEXT };
+    };
+    
+    /**
+     * @brief Makes a pyramid whose left half holds occluderDepth at every level, and whose right half is as far away
+     * as it can be. Levels that only have one column hold the far depth, as the farthest depth is what is kept.
+     */
+    unsigned int createPyramid(const float occluderDepth, int &levels)
+    {
+        levels = 1 + static_cast<int>(std::floor(std::log2(static_cast<float>(pyramidSize))));
+        
+        unsigned int pyramid { 0 };
+        glCreateTextures(GL_TEXTURE_2D, 1, &pyramid);
+        glTextureStorage2D(pyramid, levels, GL_R32F, pyramidSize, pyramidSize);
+        glTextureParameteri(pyramid, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+        glTextureParameteri(pyramid, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        
+        for (int level = 0; level < levels; ++level)
+        {
+            const int size = std::max(pyramidSize >> level, 1);
+            std::vector<float> depths(size * size, 1.f);
+            for (int y = 0; y < size; ++y)
+            {
+                for (int x = 0; x < size / 2; ++x)
+                    depths[y * size + x] = occluderDepth;
+            }
+            glTextureSubImage2D(pyramid, level, 0, 0, size, size, GL_RED, GL_FLOAT, depths.data());
+        }
+        
+        return pyramid;
+    }
+    
+    /**
+     * @brief Makes a 4.5 core context current without a surface. Prefers Mesa's surfaceless platform, which needs
+     * neither a display nor a gpu, and falls back to the default display.
+     */
+    bool createContext(Context &result)
+    {
+        const auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        
+        if (getPlatformDisplay != nullptr)
+            result.display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        if (result.display == EGL_NO_DISPLAY || !eglInitialize(result.display, nullptr, nullptr))
+        {
+            result.display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+            if (result.display == EGL_NO_DISPLAY || !eglInitialize(result.display, nullptr, nullptr))
+                return false;
+        }
+        
+        if (!eglBindAPI(EGL_OPENGL_API))
+            return false;
+        
+        const EGLint attributes[] {
+            EGL_CONTEXT_MAJOR_VERSION, 4,
+            EGL_CONTEXT_MINOR_VERSION, 5,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE };
+        result.context = eglCreateContext(result.display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, attributes);
+        
+        return result.context != EGL_NO_CONTEXT
+            && eglMakeCurrent(result.display, EGL_NO_SURFACE, EGL_NO_SURFACE, result.context);
+    }
+    
+    unsigned int createBuffer(const void *data, const std::size_t bytes)
+    {
+        unsigned int buffer { 0 };
+        glCreateBuffers(1, &buffer);
+        glNamedBufferData(buffer, static_cast<GLsizeiptr>(bytes), data, GL_DYNAMIC_DRAW);
+        return buffer;
+    }
+    
+    void runCulling(
+        const std::vector<GeometryInstance> &instances, const CameraBlock &camera, const unsigned int pyramid,
+        const int levels, const bool useDepth, CullingCounters &counters, DrawElementsIndirectCommand &command)
+    {
+        Shader cull(path::shaders() + "culling/Cull.comp");
+        const auto instanceCount = cull.uniform<int>("u_instance_count");
+        const auto isUsingDepth = cull.uniform<int>("u_use_hierarchical_depth");
+        const auto depth = cull.uniform<TextureUnit>("u_hierarchical_depth");
+        const auto depthLevels = cull.uniform<int>("u_hierarchical_depth_levels");
+        
+        // Every instance is of one unit sphere mesh, so they share the first command.
+        const std::vector<uint32_t> instanceCommands(instances.size(), 0);
+        const glm::vec4 bounds(0.f, 0.f, 0.f, 1.f);
+        const CullingCounters zero;
+        command = DrawElementsIndirectCommand { 36, 0, 0, 0, 0 };
+        
+        const std::vector<unsigned int> buffers {
+            createBuffer(nullptr, instances.size() * sizeof(GeometryInstance)),
+            createBuffer(instances.data(), instances.size() * sizeof(GeometryInstance)),
+            createBuffer(instanceCommands.data(), instanceCommands.size() * sizeof(uint32_t)),
+            createBuffer(&command, sizeof(DrawElementsIndirectCommand)),
+            createBuffer(&bounds, sizeof(glm::vec4)),
+            createBuffer(&zero, sizeof(CullingCounters)),
+        };
+        for (uint32_t i = 0; i < buffers.size(); ++i)
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, i, buffers[i]);
+        
+        const unsigned int cameraBuffer = createBuffer(&camera, sizeof(CameraBlock));
+        glBindBufferBase(GL_UNIFORM_BUFFER, 0, cameraBuffer);
+        
+        cull.bind();
+        instanceCount.set(static_cast<int>(instances.size()));
+        isUsingDepth.set(useDepth ? 1 : 0);
+        depth.set({ pyramid, 0 });
+        depthLevels.set(levels);
+        glDispatchCompute((static_cast<uint32_t>(instances.size()) + groupSize - 1) / groupSize, 1, 1);
+        glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+        
+        glGetNamedBufferSubData(buffers[5], 0, sizeof(CullingCounters), &counters);
+        glGetNamedBufferSubData(buffers[3], 0, sizeof(DrawElementsIndirectCommand), &command);
+        
+        glDeleteBuffers(static_cast<GLsizei>(buffers.size()), buffers.data());
+        glDeleteBuffers(1, &cameraBuffer);
+    }
+}
+
+int main()
+{
+    Context context;
+    if (!createContext(context))
+    {
+        std::cerr << "Skipped: an OpenGL 4.5 core context could not be made with EGL.\n";
+        if (context.display != EGL_NO_DISPLAY)
+            eglTerminate(context.display);
+        return skipCode;
+    }
+    
+    // GLEW also looks for GLX, which there is none of without a display. The core functions are loaded by then.
+    const GLenum glewResult = glewInit();
+    if (glewResult != GLEW_OK && glewResult != GLEW_ERROR_NO_GLX_DISPLAY)
+    {
+        std::cerr << "Skipped: GLEW could not be initialised.\n";
+        eglTerminate(context.display);
+        return skipCode;
+    }
+    
+    {
+        // A 90 degree camera at the origin looking down -z, so the frustum at depth d is d wide either side.
+        const glm::mat4 projection = glm::perspective(glm::radians(90.f), 1.f, 0.1f, 100.f);
+        const glm::mat4 view = glm::lookAt(glm::vec3(0.f), glm::vec3(0.f, 0.f, -1.f), glm::vec3(0.f, 1.f, 0.f));
+        const CameraBlock camera { projection * view, glm::vec4(0.f) };
+        
+        // The left half of the screen is covered by something 5 units away.
+        const glm::vec4 occluder = camera.viewProjection * glm::vec4(0.f, 0.f, -5.f, 1.f);
+        int levels { 0 };
+        const unsigned int pyramid = createPyramid(occluder.z / occluder.w * 0.5f + 0.5f, levels);
+        
+        const auto at = [](const glm::vec3 &position) {
+            return GeometryInstance { glm::translate(glm::mat4(1.f), position), glm::vec4(1.f) };
+        };
+        const std::vector<GeometryInstance> instances {
+            at(glm::vec3(-1.f, 0.f, -3.f)),    // In front of the occluder.
+            at(glm::vec3(6.f, 0.f, -20.f)),    // Beside the occluder.
+            at(glm::vec3(-6.f, 0.f, -20.f)),   // Behind the occluder.
+            at(glm::vec3(0.f, 0.f, 10.f)),     // Behind the camera.
+            at(glm::vec3(50.f, 0.f, -10.f)),   // Off to the side.
+        };
+        
+        CullingCounters counters;
+        DrawElementsIndirectCommand command;
+        runCulling(instances, camera, pyramid, levels, true, counters, command);
+        test::check(counters.visible == 2, "2 instances should be visible, not " + std::to_string(counters.visible));
+        test::check(counters.frustumCulled == 2, "2 instances should be frustum culled, not "
+            + std::to_string(counters.frustumCulled));
+        test::check(counters.occlusionCulled == 1, "1 instance should be occlusion culled, not "
+            + std::to_string(counters.occlusionCulled));
+        test::check(command.instanceCount == counters.visible, "The command should draw every visible instance.");
+        
+        // Without the pyramid only the frustum is tested.
+        runCulling(instances, camera, pyramid, levels, false, counters, command);
+        test::check(counters.visible == 3, "3 instances should be visible without depth, not "
+            + std::to_string(counters.visible));
+        test::check(counters.occlusionCulled == 0, "Nothing should be occlusion culled without depth.");
+        test::check(command.instanceCount == counters.visible, "The command should draw every visible instance.");
+        
+        glDeleteTextures(1, &pyramid);
+    }
+    
+    eglMakeCurrent(context.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroyContext(context.display, context.context);
+    eglTerminate(context.display);
+    
+    return test::finish("Culling");
+}
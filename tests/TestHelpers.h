@@ -0,0 +1,36 @@
+/**
+ * @file TestHelpers.h
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#pragma once
+
+#include "Pch.h"
+
+#include <atomic>
+
+/** The failure count and reporting that every test executable shares. */
+namespace test
+{
+    inline std::atomic<uint32_t> failures { 0 };
+    
+    /** @brief Reports message as a failure when condition is false, without stopping the test. Thread safe. */
+    inline void check(const bool condition, const std::string &message)
+    {
+        if (condition)
+            return;
+        
+        std::cerr << "FAILED: " << message << "\n";
+        ++failures;
+    }
+    
+    /** @returns The exit code of the test named name, printing that it passed when nothing failed. */
+    inline int finish(const std::string &name)
+    {
+        if (failures == 0)
+            std::cout << name << " passed.\n";
+        return failures == 0 ? 0 : 1;
+    }
+}
@@ -0,0 +1,73 @@
+/**
+ * @file WorkStealingPoolTest.cpp
+ * @author Ryan Purse
+ * @date 19/10/2026
+ */
+
+
+#include "Pch.h"
+#include "WorkStealingPool.h"
+#include "Timers.h"
+#include "TestHelpers.h"
+
+#include <thread>
+
+/**
+ * Stresses the pool with parallelFor calls nested inside each other and started from several threads at once, which
+ * is how parallel systems, world batches and the scheduler use it. Every index must be visited exactly once, and every
+ * task must see the fixed time of the thread that started it. Build with -fsanitize=thread to check it for races.
+ */
+namespace
+{
+    constexpr uint32_t submitterCount   { 4 };
+    constexpr uint32_t repeats          { 50 };
+    constexpr uint32_t outerCount       { 64 };
+    constexpr uint32_t innerCount       { 256 };
+    
+    /** @brief Runs a parallelFor in every chunk of another, as if it came from a different tick rate. */
+    void runNested(WorkStealingPool &pool, const double fixedTime)
+    {
+        timers::FixedTimeScope fixedTimeScope(fixedTime);
+        
+        std::vector<std::atomic<uint32_t>> visits(outerCount * innerCount);
+        std::atomic<uint32_t> wrongFixedTimes { 0 };
+        
+        pool.parallelFor(outerCount, 4, [&](const uint32_t first, const uint32_t last) {
+            for (uint32_t outer = first; outer < last; ++outer)
+            {
+                pool.parallelFor(innerCount, 16, [&](const uint32_t innerFirst, const uint32_t innerLast) {
+                    if (timers::fixedTime<double>() != fixedTime)
+                        ++wrongFixedTimes;
+                    
+                    for (uint32_t inner = innerFirst; inner < innerLast; ++inner)
+                        ++visits[outer * innerCount + inner];
+                });
+            }
+        });
+        
+        const bool isVisitedOnce = std::all_of(visits.begin(), visits.end(), [](const std::atomic<uint32_t> &visit) {
+            return visit == 1;
+        });
+        test::check(isVisitedOnce, "Every index should be visited exactly once.");
+        test::check(wrongFixedTimes == 0, std::to_string(wrongFixedTimes) + " tasks did not see their fixed time.");
+    }
+}
+
+int main()
+{
+    WorkStealingPool pool(std::max(std::thread::hardware_concurrency(), 2u));
+    
+    std::vector<std::thread> submitters;
+    for (uint32_t i = 0; i < submitterCount; ++i)
+    {
+        submitters.emplace_back([&pool, i]() {
+            for (uint32_t repeat = 0; repeat < repeats; ++repeat)
+                runNested(pool, 0.01 * (i + 1));
+        });
+    }
+    
+    for (std::thread &submitter : submitters)
+        submitter.join();
+    
+    return test::finish("Work stealing pool");
+}